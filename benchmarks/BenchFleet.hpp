@@ -0,0 +1,71 @@
+#ifndef BENCH_FLEET_HPP
+#define BENCH_FLEET_HPP
+
+#include "FleetSimulator.hpp"
+#include "RobotSimulator.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+// The robot mix shared by the benchmarks and the load generator, so their
+// numbers describe the same fleet: 1/2 circular, 1/4 linear, 1/4 stationary.
+namespace BenchFleet
+{
+    inline void configureRobot(FleetSimulator& fleet, std::size_t i)
+    {
+        switch (i % 4)
+        {
+            case 0:
+            case 1:
+                fleet.setCircularMotion(i, 5.0 + (i % 7), 0.2 + 0.01 * (i % 5));
+                break;
+            case 2:
+                fleet.setLinearMotion(i, 1.0 + 0.1 * (i % 3), 0.3 * (i % 11));
+                break;
+            case 3:
+                fleet.setStationary(i, static_cast<double>(i % 100), static_cast<double>(i % 37));
+                break;
+        }
+        fleet.setBatteryDrainRate(i, 0.1f + 0.05f * (i % 4));
+    }
+
+    inline void configureRobot(RobotSimulator& sim, std::size_t i)
+    {
+        switch (i % 4)
+        {
+            case 0:
+            case 1:
+                sim.setCircularMotion(5.0 + (i % 7), 0.2 + 0.01 * (i % 5));
+                break;
+            case 2:
+                sim.setLinearMotion(1.0 + 0.1 * (i % 3), 0.3 * (i % 11));
+                break;
+            case 3:
+                sim.setStationary(static_cast<double>(i % 100), static_cast<double>(i % 37));
+                break;
+        }
+        sim.setBatteryDrainRate(0.1f + 0.05f * (i % 4));
+    }
+
+    // "robot_0000", "robot_0001", ...
+    inline std::string robotId(std::size_t i)
+    {
+        // room for any size_t
+        char id[32];
+        std::snprintf(id, sizeof(id), "robot_%04zu", i);
+        return id;
+    }
+
+    // robots 0 .. robots-1, named by robotId()
+    inline void buildFleet(FleetSimulator& fleet, std::size_t robots)
+    {
+        fleet.reserve(robots);
+        for (std::size_t i = 0; i < robots; i++)
+        {
+            fleet.addRobot(robotId(i));
+            configureRobot(fleet, i);
+        }
+    }
+}
+
+#endif // BENCH_FLEET_HPP
@@ -0,0 +1,292 @@
+// Batched publishing benchmark: one RobotTelemetry sample per robot vs RobotTelemetryBatch
+//
+// usage: batch_bench [--robots N] [--ticks N] [--sizes 1,16,64,256] [--max-bytes N]
+//
+// Steps a fleet of --robots (default 1000) for --ticks (default 200) and
+// publishes every robot of every tick, as fast as the RELIABLE KEEP_ALL
+// writer takes them: first one RobotTelemetry sample per robot, then through
+// RobotPublisher::initBatch() for each batch size of --sizes, with the byte
+// budget --max-bytes (default RobotPublisher::kDefaultBatchBytes) and a
+// flush() per tick. A subscriber in the same process (intraprocess delivery
+// off, UDPv4 only) unpacks the batches into the per-robot callback.
+//
+// Per robot sample it reports the publisher thread's CPU time (fill +
+// serialize + write, the fleet update excluded), the whole process's CPU
+// time (publisher, subscriber and DDS threads, until the last sample is
+// delivered), the loopback bytes sent (/proc/net/dev, so RTPS/UDP/IP
+// headers, acks and heartbeats are in) and the DDS samples on the wire.
+
+#include "RobotPublisher.hpp"
+#include "RobotSubscriber.hpp"
+#include "FleetSimulator.hpp"
+#include "BenchFleet.hpp"
+#include "QoSProfiles.hpp"
+#include <fastdds/LibrarySettings.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <time.h>
+
+namespace
+{
+    struct Options
+    {
+        std::size_t robots = 1000;
+        int ticks = 200;
+        std::vector<std::size_t> sizes = {1, 16, 64, 256};
+        std::size_t max_bytes = RobotPublisher::kDefaultBatchBytes;
+    };
+
+    struct Result
+    {
+        std::string mode;
+        uint64_t delivered;
+        uint64_t dds_samples;
+        double publisher_ns;    // per robot sample
+        double process_ns;      // per robot sample
+        double wire_bytes;      // per robot sample, -1 without /proc/net/dev
+    };
+
+    std::vector<std::string> splitList(const std::string& list)
+    {
+        std::vector<std::string> items;
+        std::stringstream stream(list);
+        std::string item;
+        while (std::getline(stream, item, ','))
+        {
+            if (!item.empty())
+                items.push_back(item);
+        }
+        return items;
+    }
+
+    bool parseOptions(int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string arg = argv[i];
+            if (arg == "--robots" && i + 1 < argc)
+                options.robots = std::max<std::size_t>(1, std::strtoull(argv[++i], nullptr, 10));
+            else if (arg == "--ticks" && i + 1 < argc)
+                options.ticks = std::max(1, std::atoi(argv[++i]));
+            else if (arg == "--sizes" && i + 1 < argc)
+            {
+                options.sizes.clear();
+                for (const std::string& size : splitList(argv[++i]))
+                    options.sizes.push_back(std::max<std::size_t>(1, std::strtoull(size.c_str(), nullptr, 10)));
+            }
+            else if (arg == "--max-bytes" && i + 1 < argc)
+                options.max_bytes = std::strtoull(argv[++i], nullptr, 10);
+            else
+                return false;
+        }
+        return true;
+    }
+
+    int64_t cpuNs(clockid_t clock)
+    {
+        timespec ts;
+        clock_gettime(clock, &ts);
+        return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+    }
+
+    // TX bytes of the loopback interface, -1 if /proc/net/dev has none
+    int64_t loopbackTxBytes()
+    {
+        std::ifstream in("/proc/net/dev");
+        std::string line;
+        while (std::getline(in, line))
+        {
+            std::size_t colon = line.find(':');
+            std::istringstream name(line.substr(0, colon == std::string::npos ? 0 : colon));
+            std::string interface;
+            if (colon == std::string::npos || !(name >> interface) || interface != "lo")
+                continue;
+
+            // receive: bytes packets errs drop fifo frame compressed multicast, then transmit bytes
+            std::istringstream fields(line.substr(colon + 1));
+            int64_t value = 0;
+            for (int i = 0; i < 9 && fields >> value; i++)
+            {
+            }
+            return fields ? value : -1;
+        }
+        return -1;
+    }
+
+    bool waitForMatch(RobotPublisher& publisher, RobotSubscriber& subscriber)
+    {
+        for (int i = 0; i < 100; i++)
+        {
+            if (publisher.getMatchedSubscribers() > 0 && subscriber.getMatchedPublishers() > 0)
+                return true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+        return false;
+    }
+
+    // batch_size 0: one RobotTelemetry sample per robot
+    bool runMode(std::size_t batch_size, const Options& options, Result& result)
+    {
+        DomainParticipantQos pqos = QoSProfiles::getUdpOnlyParticipantQoS();
+        DataWriterQos writer_qos = QoSProfiles::getReliableKeepAllWriterQoS();
+        DataReaderQos reader_qos = QoSProfiles::getReliableKeepAllReaderQoS();
+
+        FleetSimulator fleet;
+        BenchFleet::buildFleet(fleet, options.robots);
+
+        std::atomic<uint64_t> delivered(0);
+        std::atomic<uint64_t> dds_samples(0);
+        // the records of one batch share their SampleInfo
+        int64_t last_sequence = -1;
+
+        RobotPublisher publisher;
+        RobotSubscriber subscriber;
+        publisher.setTopicName("batch_bench");
+        subscriber.setTopicName("batch_bench");
+        subscriber.setSampleCallback([&](const RobotTelemetry&, const SampleInfo& info)
+        {
+            int64_t sequence = info.sample_identity.sequence_number().to64long();
+            if (sequence != last_sequence)
+            {
+                last_sequence = sequence;
+                dds_samples.fetch_add(1, std::memory_order_relaxed);
+            }
+            delivered.fetch_add(1, std::memory_order_relaxed);
+        });
+
+        bool initialized = batch_size == 0
+            ? subscriber.init(reader_qos, pqos) && publisher.init(writer_qos, pqos)
+            : subscriber.initBatch(reader_qos, pqos) &&
+              publisher.initBatch(writer_qos, batch_size, options.max_bytes, pqos);
+        if (!initialized || !waitForMatch(publisher, subscriber))
+        {
+            std::cerr << "[Bench] setup or matching failed" << std::endl;
+            return false;
+        }
+
+        const double dt = 0.1;
+        const uint64_t expected = options.robots * static_cast<uint64_t>(options.ticks);
+        int64_t publish_ns = 0;
+        int64_t process_start = cpuNs(CLOCK_PROCESS_CPUTIME_ID);
+        int64_t tx_start = loopbackTxBytes();
+
+        for (int tick = 0; tick < options.ticks; tick++)
+        {
+            fleet.update(dt);
+
+            int64_t start = cpuNs(CLOCK_THREAD_CPUTIME_ID);
+            for (std::size_t i = 0; i < options.robots; i++)
+                publisher.publishLoaned([&fleet, i](RobotTelemetry& sample) { fleet.fillTelemetry(i, sample); });
+            publisher.flush();
+            publish_ns += cpuNs(CLOCK_THREAD_CPUTIME_ID) - start;
+        }
+
+        // until everything is delivered, or 10 s without progress
+        uint64_t seen = 0;
+        for (int idle = 0; idle < 200 && delivered.load() < expected; idle++)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            if (delivered.load() != seen)
+            {
+                seen = delivered.load();
+                idle = 0;
+            }
+        }
+
+        int64_t process_ns = cpuNs(CLOCK_PROCESS_CPUTIME_ID) - process_start;
+        int64_t tx_end = loopbackTxBytes();
+
+        publisher.stop();
+        subscriber.stop();
+
+        result.mode = batch_size == 0 ? "per-robot" : "batch-" + std::to_string(batch_size);
+        result.delivered = delivered.load();
+        result.dds_samples = dds_samples.load();
+        result.publisher_ns = static_cast<double>(publish_ns) / expected;
+        result.process_ns = static_cast<double>(process_ns) / expected;
+        result.wire_bytes = tx_start >= 0 && tx_end >= 0 ? static_cast<double>(tx_end - tx_start) / expected : -1.0;
+        return true;
+    }
+
+    void printResult(const Result& r, const Result& reference, uint64_t expected)
+    {
+        std::cout << std::fixed << std::left << std::setw(12) << r.mode << std::right
+                  << std::setw(10) << r.delivered << "/" << expected
+                  << std::setw(10) << r.dds_samples
+                  << std::setprecision(0) << std::setw(12) << r.publisher_ns
+                  << std::setw(12) << r.process_ns;
+        if (r.wire_bytes >= 0.0)
+            std::cout << std::setprecision(1) << std::setw(12) << r.wire_bytes;
+        else
+            std::cout << std::setw(12) << "n/a";
+        std::cout << std::setprecision(2) << std::setw(10) << reference.process_ns / r.process_ns << "x";
+        if (r.wire_bytes > 0.0 && reference.wire_bytes > 0.0)
+            std::cout << std::setw(9) << reference.wire_bytes / r.wire_bytes << "x";
+        std::cout << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        std::cerr << "usage: " << argv[0] << " [--robots N] [--ticks N] [--sizes 1,16,64,256] [--max-bytes N]"
+                  << std::endl;
+        return 1;
+    }
+
+    // every profile below keeps one instance per robot (default cap: 1024)
+    QoSProfiles::setFleetSize(static_cast<int32_t>(std::min<std::size_t>(options.robots, INT32_MAX)));
+
+    // in-process delivery would skip the transport
+    eprosima::fastdds::LibrarySettings settings;
+    settings.intraprocess_delivery = eprosima::fastdds::INTRAPROCESS_OFF;
+    DomainParticipantFactory::get_instance()->set_library_settings(settings);
+
+    std::cout << "=== Batched publishing benchmark ===" << std::endl;
+    std::cout << "Robots: " << options.robots << " | Ticks: " << options.ticks
+              << " | Batch budget: " << options.max_bytes << " B | UDPv4 loopback, RELIABLE KEEP_ALL" << std::endl;
+
+    std::vector<std::size_t> modes = {0};
+    modes.insert(modes.end(), options.sizes.begin(), options.sizes.end());
+
+    const uint64_t expected = options.robots * static_cast<uint64_t>(options.ticks);
+    std::vector<Result> results;
+    bool ok = true;
+    for (std::size_t batch_size : modes)
+    {
+        Result result;
+        if (!runMode(batch_size, options, result))
+        {
+            ok = false;
+            continue;
+        }
+        if (result.delivered != expected)
+            ok = false;
+        results.push_back(result);
+    }
+
+    if (results.empty())
+        return 1;
+
+    // ns and bytes are per robot sample; the ratios are against the first mode
+    std::cout << "\n" << std::left << std::setw(12) << "mode" << std::right
+              << std::setw(17) << "delivered" << std::setw(10) << "DDS smp"
+              << std::setw(12) << "pub ns" << std::setw(12) << "proc ns" << std::setw(12) << "wire B"
+              << std::setw(11) << "CPU gain" << std::setw(10) << "BW gain" << std::endl;
+    for (const Result& result : results)
+        printResult(result, results.front(), expected);
+
+    return ok ? 0 : 1;
+}
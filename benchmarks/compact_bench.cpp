@@ -0,0 +1,167 @@
+// Compact topic benchmark: RobotTelemetry vs RobotTelemetryPlain vs RobotTelemetryCompact
+//
+// usage: compact_bench [robots=1000] [rate_hz=10] [seconds=60]
+//
+// Simulates a fleet for `seconds` at `rate_hz` and, per type and XCDR version,
+// reports the serialized bytes per sample (encapsulation included, RTPS/UDP
+// headers are the same for every type and not counted) and the fleet payload
+// bandwidth at that rate. For the compact type it also checks every sample
+// survives fromCompact -> toCompact unchanged, reports the worst quantization
+// error against the full-precision sample and the conversion cost.
+
+#include "FleetSimulator.hpp"
+#include "BenchFleet.hpp"
+#include "RobotTelemetryPubSubTypes.hpp"
+#include "RobotTelemetryPlainPubSubTypes.hpp"
+#include "RobotTelemetryCompactPubSubTypes.hpp"
+#include "TelemetryConversions.hpp"
+#include <fastdds/rtps/common/SerializedPayload.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using eprosima::fastdds::dds::DataRepresentationId_t;
+
+namespace
+{
+    // distance between two headings, 0 and 2pi being the same heading
+    double headingError(double a, double b)
+    {
+        double d = std::fmod(std::abs(a - b), 2 * M_PI);
+        return std::min(d, 2 * M_PI - d);
+    }
+
+    struct TypeBytes
+    {
+        const char* name;
+        uint64_t bytes[2];   // XCDRv1, XCDRv2
+    };
+
+    struct QuantizationError
+    {
+        double position = 0.0;      // m
+        double orientation = 0.0;   // rad
+        double speed = 0.0;         // m/s
+        double battery = 0.0;       // %
+    };
+
+    double kilobytesPerSecond(uint64_t bytes, uint64_t samples, std::size_t robots, double rate_hz)
+    {
+        return static_cast<double>(bytes) / samples * robots * rate_hz / 1024.0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t robots = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000;
+    double rate_hz = argc > 2 ? std::atof(argv[2]) : 10.0;
+    double seconds = argc > 3 ? std::atof(argv[3]) : 60.0;
+    if (robots == 0 || rate_hz <= 0.0 || seconds <= 0.0)
+    {
+        std::cerr << "usage: compact_bench [robots=1000] [rate_hz=10] [seconds=60]" << std::endl;
+        return 1;
+    }
+
+    const double dt = 1.0 / rate_hz;
+    const int ticks = std::max(1, static_cast<int>(seconds * rate_hz));
+
+    std::cout << "=== Compact topic benchmark ===" << std::endl;
+    std::cout << "Robots: " << robots << " | Rate: " << rate_hz << " Hz | Ticks: " << ticks << std::endl;
+
+    FleetSimulator fleet;
+    BenchFleet::buildFleet(fleet, robots);
+
+    RobotTelemetryPubSubType full_type;
+    RobotTelemetryPlainPubSubType plain_type;
+    RobotTelemetryCompactPubSubType compact_type;
+    const DataRepresentationId_t representations[2] = {
+        DataRepresentationId_t::XCDR_DATA_REPRESENTATION,
+        DataRepresentationId_t::XCDR2_DATA_REPRESENTATION};
+
+    TypeBytes types[3] = {{"RobotTelemetry", {0, 0}},
+                          {"RobotTelemetryPlain", {0, 0}},
+                          {"RobotTelemetryCompact", {0, 0}}};
+
+    RobotTelemetry telemetry;
+    RobotTelemetryPlain plain;
+    RobotTelemetryCompact compact;
+    RobotTelemetryCompact again;
+    RobotTelemetry decoded;
+    QuantizationError error;
+    uint64_t samples = 0;
+    uint64_t mismatches = 0;
+    std::chrono::steady_clock::duration convert_time{};
+
+    for (int tick = 0; tick < ticks; tick++)
+    {
+        fleet.update(dt);
+        for (std::size_t i = 0; i < robots; i++)
+        {
+            fleet.fillTelemetry(i, telemetry);
+
+            auto start = std::chrono::steady_clock::now();
+            TelemetryConversions::toCompact(telemetry, compact);
+            TelemetryConversions::fromCompact(compact, decoded);
+            convert_time += std::chrono::steady_clock::now() - start;
+
+            TelemetryConversions::toCompact(decoded, again);
+            if (again != compact)
+                mismatches++;
+
+            error.position = std::max(error.position, std::max(std::abs(decoded.x() - telemetry.x()),
+                                                               std::abs(decoded.y() - telemetry.y())));
+            error.orientation = std::max(error.orientation, headingError(decoded.orientation(), telemetry.orientation()));
+            error.speed = std::max(error.speed, std::abs(decoded.speed() - telemetry.speed()));
+            error.battery = std::max(error.battery,
+                                     static_cast<double>(std::abs(decoded.battery_level() - telemetry.battery_level())));
+
+            TelemetryConversions::toPlain(telemetry, plain);
+            for (int r = 0; r < 2; r++)
+            {
+                types[0].bytes[r] += full_type.calculate_serialized_size(&telemetry, representations[r]);
+                types[1].bytes[r] += plain_type.calculate_serialized_size(&plain, representations[r]);
+                types[2].bytes[r] += compact_type.calculate_serialized_size(&compact, representations[r]);
+            }
+            samples++;
+        }
+    }
+
+    std::cout << std::fixed;
+    for (int r = 0; r < 2; r++)
+    {
+        const uint64_t full_bytes = types[0].bytes[r];
+        std::cout << "\n--- XCDRv" << (r + 1) << " ---" << std::endl;
+        std::cout << std::left << std::setw(24) << "type" << std::right
+                  << std::setw(12) << "B/sample" << std::setw(14) << "fleet KB/s"
+                  << std::setw(10) << "saved" << std::endl;
+        for (const TypeBytes& type : types)
+        {
+            double saved = 100.0 * (1.0 - static_cast<double>(type.bytes[r]) / full_bytes);
+            std::cout << std::left << std::setw(24) << type.name << std::right
+                      << std::setw(12) << std::setprecision(1) << static_cast<double>(type.bytes[r]) / samples
+                      << std::setw(14) << std::setprecision(1) << kilobytesPerSecond(type.bytes[r], samples, robots, rate_hz)
+                      << std::setw(9) << std::setprecision(1) << saved << "%" << std::endl;
+        }
+
+        double saved_kbs = kilobytesPerSecond(full_bytes - types[2].bytes[r], samples, robots, rate_hz);
+        std::cout << "Compact saves " << std::setprecision(1) << saved_kbs << " KB/s ("
+                  << std::setprecision(2) << saved_kbs * 3600.0 / (1024.0 * 1024.0) << " GB/h) for the fleet" << std::endl;
+    }
+
+    double convert_ns = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(convert_time).count()) / samples;
+
+    std::cout << "\n--- RobotTelemetryCompact quantization ---" << std::endl;
+    std::cout << "Samples: " << samples << " | round-trip mismatches: " << mismatches << std::endl;
+    std::cout << "Max error: position " << std::setprecision(4) << error.position * 1000.0 << " mm"
+              << " | orientation " << error.orientation * 180.0 / M_PI << " deg"
+              << " | speed " << error.speed * 1000.0 << " mm/s"
+              << " | battery " << error.battery << " %" << std::endl;
+    std::cout << "toCompact + fromCompact: " << std::setprecision(1) << convert_ns << " ns/sample" << std::endl;
+
+    return mismatches == 0 ? 0 : 1;
+}
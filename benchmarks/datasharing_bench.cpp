@@ -0,0 +1,219 @@
+// Same-host delivery benchmark: UDPv4 / SHM transports vs data-sharing
+//
+// usage: datasharing_bench [samples=10000] [period_us=1000]
+//
+// One publisher and one subscriber (separate participants) in this process,
+// with intraprocess delivery turned off so samples go through the transport
+// (or the data-sharing segment) as they would between two processes.
+// The timestamp field carries steady_clock ns at publish time; the reader
+// callback stores now - timestamp, printed as one-way latency percentiles.
+
+#include "RobotPublisher.hpp"
+#include "RobotSubscriber.hpp"
+#include "RobotSimulator.hpp"
+#include "QoSProfiles.hpp"
+#include <fastdds/LibrarySettings.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    enum class Path
+    {
+        UDP,
+        SHM,
+        SHM_PLAIN,
+        DATA_SHARING
+    };
+
+    const char* pathName(Path path)
+    {
+        switch (path)
+        {
+            case Path::UDP:          return "UDPv4 / RobotTelemetry";
+            case Path::SHM:          return "SHM / RobotTelemetry";
+            case Path::SHM_PLAIN:    return "SHM / RobotTelemetryPlain";
+            case Path::DATA_SHARING: return "DATA-SHARING / Plain";
+        }
+        return "?";
+    }
+
+    uint64_t steadyNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    struct Result
+    {
+        std::size_t received;
+        double p50_us;
+        double p99_us;
+        double max_us;
+    };
+
+    bool waitForMatch(RobotPublisher& publisher, RobotSubscriber& subscriber)
+    {
+        for (int i = 0; i < 100; i++)
+        {
+            if (publisher.getMatchedSubscribers() > 0 && subscriber.getMatchedPublishers() > 0)
+                return true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+        return false;
+    }
+
+    bool runPath(Path path, int samples, int period_us, Result& result)
+    {
+        DataWriterQos writer_qos = QoSProfiles::getDataSharingWriterQoS();
+        DataReaderQos reader_qos = QoSProfiles::getDataSharingReaderQoS();
+        DomainParticipantQos pqos = PARTICIPANT_QOS_DEFAULT;
+
+        if (path == Path::DATA_SHARING)
+        {
+            // force it: endpoint creation fails instead of silently using a transport
+            writer_qos.data_sharing().on("");
+            reader_qos.data_sharing().on("");
+        }
+        else
+        {
+            writer_qos.data_sharing().off();
+            reader_qos.data_sharing().off();
+            pqos = path == Path::UDP ? QoSProfiles::getUdpOnlyParticipantQoS()
+                                     : QoSProfiles::getShmOnlyParticipantQoS();
+        }
+
+        bool plain = path == Path::SHM_PLAIN || path == Path::DATA_SHARING;
+
+        std::vector<double> latencies(samples, 0.0);
+        std::atomic<int> received(0);
+        std::atomic<bool> recording(false);
+
+        RobotSubscriber subscriber;
+        subscriber.setSampleCallback([&](const RobotTelemetry& telemetry, const SampleInfo&)
+        {
+            double us = static_cast<double>(steadyNs() - telemetry.timestamp()) / 1000.0;
+            if (!recording.load(std::memory_order_acquire))
+                return;
+            int index = received.fetch_add(1, std::memory_order_relaxed);
+            if (index < samples)
+                latencies[index] = us;
+        });
+
+        RobotPublisher publisher;
+        bool initialized = plain
+            ? subscriber.initPlain(reader_qos, pqos) && publisher.initPlain(writer_qos, pqos)
+            : subscriber.init(reader_qos, pqos) && publisher.init(writer_qos, pqos);
+
+        if (!initialized || !waitForMatch(publisher, subscriber))
+        {
+            std::cerr << "[Bench] " << pathName(path) << ": setup or matching failed" << std::endl;
+            return false;
+        }
+
+        RobotSimulator simulator("robo003");
+        simulator.setCircularMotion(5.0, 0.2);
+
+        auto publishOne = [&]()
+        {
+            simulator.update(0.1);
+            if (plain)
+            {
+                publisher.publishPlain([&simulator](RobotTelemetryPlain& sample)
+                {
+                    simulator.fillTelemetry(sample);
+                    sample.timestamp(steadyNs());
+                });
+            }
+            else
+            {
+                publisher.publishLoaned([&simulator](RobotTelemetry& sample)
+                {
+                    simulator.fillTelemetry(sample);
+                    sample.timestamp(steadyNs());
+                });
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(period_us));
+        };
+
+        // warm up (discovery traffic, first loans, caches)
+        for (int i = 0; i < 200; i++)
+            publishOne();
+
+        recording.store(true, std::memory_order_release);
+        for (int i = 0; i < samples; i++)
+            publishOne();
+
+        // let the last samples arrive
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        recording.store(false, std::memory_order_release);
+
+        publisher.stop();
+        subscriber.stop();
+
+        std::size_t count = std::min(received.load(), samples);
+        if (count == 0)
+        {
+            std::cerr << "[Bench] " << pathName(path) << ": nothing received" << std::endl;
+            return false;
+        }
+
+        latencies.resize(count);
+        std::sort(latencies.begin(), latencies.end());
+
+        result.received = count;
+        result.p50_us = latencies[count / 2];
+        result.p99_us = latencies[count * 99 / 100];
+        result.max_us = latencies.back();
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int samples = argc > 1 ? std::atoi(argv[1]) : 10000;
+    int period_us = argc > 2 ? std::atoi(argv[2]) : 1000;
+
+    // in-process delivery would skip transports and data-sharing alike
+    eprosima::fastdds::LibrarySettings settings;
+    settings.intraprocess_delivery = eprosima::fastdds::INTRAPROCESS_OFF;
+    DomainParticipantFactory::get_instance()->set_library_settings(settings);
+
+    std::cout << "=== Same-host delivery benchmark (" << samples << " samples, "
+              << period_us << " us period) ===" << std::endl;
+    std::cout << "RobotTelemetry max serialized size:      "
+              << RobotTelemetryPubSubType().max_serialized_type_size << " bytes" << std::endl;
+    std::cout << "RobotTelemetryPlain max serialized size: "
+              << RobotTelemetryPlainPubSubType().max_serialized_type_size << " bytes" << std::endl;
+
+    const Path paths[] = {Path::UDP, Path::SHM, Path::SHM_PLAIN, Path::DATA_SHARING};
+    std::vector<std::pair<Path, Result>> results;
+
+    for (Path path : paths)
+    {
+        Result result;
+        if (runPath(path, samples, period_us, result))
+            results.emplace_back(path, result);
+    }
+
+    std::cout << std::endl;
+    for (const auto& entry : results)
+    {
+        const Result& r = entry.second;
+        std::cout << std::fixed << std::setprecision(1)
+                  << std::left << std::setw(28) << pathName(entry.first) << std::right
+                  << " | received: " << std::setw(6) << r.received
+                  << " | p50: " << std::setw(8) << r.p50_us << " us"
+                  << " | p99: " << std::setw(8) << r.p99_us << " us"
+                  << " | max: " << std::setw(9) << r.max_us << " us" << std::endl;
+    }
+
+    return results.size() == sizeof(paths) / sizeof(paths[0]) ? 0 : 1;
+}
@@ -0,0 +1,245 @@
+// Delta/keyframe stream benchmark: TelemetryDeltaEncoder / TelemetryDeltaDecoder
+//
+// usage: delta_bench [robots=1000] [ticks=600] [keyframe_interval=20] [loss=0]
+//
+// Steps a fleet at 10 Hz, encodes every robot's sample, drops each frame with
+// probability `loss` and decodes the rest. Timestamps are the tick time plus
+// up to +-100 us of jitter, like a TickScheduler-paced publisher (the
+// simulator's own clock reads would be microseconds apart here).
+//
+// Reports the frame bytes (keyframes, deltas, average), the serialized
+// RobotTelemetryDelta sample against RobotTelemetry (XCDRv2, encapsulation
+// included), encode and decode cost per sample, and checks every decoded
+// sample equals fromCompact(toCompact(original)). With loss > 0 it also shows
+// how many samples were skipped waiting for the next keyframe.
+//
+// The same samples also go through the batched path: the records of
+// kBatchRobots robots per RobotTelemetryDeltaBatch (RobotPublisher::initDeltaBatch),
+// where a batch is lost as a whole.
+
+#include "FleetSimulator.hpp"
+#include "BenchFleet.hpp"
+#include "RobotTelemetryPubSubTypes.hpp"
+#include "RobotTelemetryDeltaPubSubTypes.hpp"
+#include "RobotTelemetryDeltaBatchPubSubTypes.hpp"
+#include "TelemetryConversions.hpp"
+#include "TelemetryDeltaCodec.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using eprosima::fastdds::dds::DataRepresentationId_t;
+
+namespace
+{
+    // robots per batch, as RobotPublisher::kMaxBatchSamples
+    const std::size_t kBatchRobots = 256;
+
+    double nsPerSample(std::chrono::steady_clock::duration elapsed, uint64_t samples)
+    {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / samples;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t robots = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000;
+    int ticks = argc > 2 ? std::atoi(argv[2]) : 600;
+    uint32_t keyframe_interval = argc > 3 ? static_cast<uint32_t>(std::atoi(argv[3])) : 20;
+    double loss = argc > 4 ? std::atof(argv[4]) : 0.0;
+    if (robots == 0 || ticks <= 0 || keyframe_interval == 0 || loss < 0.0 || loss >= 1.0)
+    {
+        std::cerr << "usage: delta_bench [robots=1000] [ticks=600] [keyframe_interval=20] [loss=0]" << std::endl;
+        return 1;
+    }
+
+    const double dt = 0.1;
+    const uint64_t period_ns = 100000000ULL;
+
+    std::cout << "=== Delta stream benchmark ===" << std::endl;
+    std::cout << "Robots: " << robots << " | Ticks: " << ticks << " | Keyframe every " << keyframe_interval
+              << " | Loss: " << loss << std::endl;
+
+    FleetSimulator fleet;
+    BenchFleet::buildFleet(fleet, robots);
+
+    TelemetryDeltaEncoder encoder(keyframe_interval);
+    TelemetryDeltaDecoder decoder;
+    RobotTelemetryPubSubType full_type;
+    RobotTelemetryDeltaPubSubType delta_type;
+    RobotTelemetryDeltaBatchPubSubType batch_type;
+    TelemetryDeltaEncoder batch_encoder(keyframe_interval);
+    TelemetryDeltaDecoder batch_decoder;
+    RobotTelemetryDeltaBatch batch;
+    const std::string writer = "delta_bench";
+
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<int64_t> jitter(-100000, 100000);
+    std::bernoulli_distribution lost(loss);
+
+    std::vector<RobotTelemetry> samples(robots);
+    std::vector<RobotTelemetryDelta> frames(robots);
+    std::vector<bool> keyframe(robots);
+    RobotTelemetry decoded;
+    RobotTelemetry expected;
+    RobotTelemetryCompact compact;
+
+    uint64_t encoded = 0;
+    uint64_t delivered = 0;
+    uint64_t mismatches = 0;
+    uint64_t keyframe_count = 0;
+    uint64_t keyframe_bytes = 0;
+    uint64_t delta_bytes = 0;
+    uint64_t full_payload = 0;
+    uint64_t delta_payload = 0;
+    uint64_t batch_delivered = 0;
+    uint64_t batch_mismatches = 0;
+    uint64_t batch_bytes = 0;
+    uint64_t batch_payload = 0;
+    std::vector<RobotTelemetry> batch_expected;
+    std::size_t batch_next = 0;
+    std::chrono::steady_clock::duration encode_time{};
+    std::chrono::steady_clock::duration decode_time{};
+    std::chrono::steady_clock::duration batch_encode_time{};
+    std::chrono::steady_clock::duration batch_decode_time{};
+    const uint64_t start_ns = 1700000000000000000ULL;
+
+    for (int tick = 0; tick < ticks; tick++)
+    {
+        fleet.update(dt);
+        for (std::size_t i = 0; i < robots; i++)
+        {
+            fleet.fillTelemetry(i, samples[i]);
+            samples[i].timestamp(start_ns + tick * period_ns + jitter(rng));
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < robots; i++)
+        {
+            frames[i].id(samples[i].id());
+            keyframe[i] = encoder.encode(samples[i], frames[i].frame());
+        }
+        encode_time += std::chrono::steady_clock::now() - start;
+
+        for (std::size_t i = 0; i < robots; i++)
+        {
+            std::size_t bytes = frames[i].frame().size();
+            if (keyframe[i])
+            {
+                keyframe_count++;
+                keyframe_bytes += bytes;
+            }
+            else
+            {
+                delta_bytes += bytes;
+            }
+            full_payload += full_type.calculate_serialized_size(&samples[i], DataRepresentationId_t::XCDR2_DATA_REPRESENTATION);
+            delta_payload += delta_type.calculate_serialized_size(&frames[i], DataRepresentationId_t::XCDR2_DATA_REPRESENTATION);
+        }
+        encoded += robots;
+
+        for (std::size_t i = 0; i < robots; i++)
+        {
+            if (loss > 0.0 && lost(rng))
+                continue;
+
+            start = std::chrono::steady_clock::now();
+            bool ok = decoder.decode(frames[i].id(), frames[i].frame(), decoded);
+            decode_time += std::chrono::steady_clock::now() - start;
+            if (!ok)
+                continue;
+
+            delivered++;
+            TelemetryConversions::toCompact(samples[i], compact);
+            TelemetryConversions::fromCompact(compact, expected);
+            if (decoded != expected)
+                mismatches++;
+        }
+
+        for (std::size_t first = 0; first < robots; first += kBatchRobots)
+        {
+            std::size_t last = std::min(robots, first + kBatchRobots);
+
+            batch.records().clear();
+            start = std::chrono::steady_clock::now();
+            for (std::size_t i = first; i < last; i++)
+                batch_encoder.encodeRecord(samples[i], batch.records());
+            batch_encode_time += std::chrono::steady_clock::now() - start;
+
+            batch_bytes += batch.records().size();
+            batch_payload += batch_type.calculate_serialized_size(&batch, DataRepresentationId_t::XCDR2_DATA_REPRESENTATION);
+
+            if (loss > 0.0 && lost(rng))
+                continue;
+
+            // the records come back in publish order
+            batch_expected.clear();
+            for (std::size_t i = first; i < last; i++)
+            {
+                TelemetryConversions::toCompact(samples[i], compact);
+                batch_expected.emplace_back();
+                TelemetryConversions::fromCompact(compact, batch_expected.back());
+            }
+
+            start = std::chrono::steady_clock::now();
+            batch_decoder.decodeRecords(writer, batch.records(), [&](const RobotTelemetry& telemetry)
+            {
+                batch_delivered++;
+                while (batch_next < batch_expected.size() && batch_expected[batch_next].id() != telemetry.id())
+                    batch_next++;
+                if (batch_next == batch_expected.size() || batch_expected[batch_next] != telemetry)
+                    batch_mismatches++;
+            });
+            batch_decode_time += std::chrono::steady_clock::now() - start;
+            batch_next = 0;
+        }
+    }
+
+    uint64_t delta_count = encoded - keyframe_count;
+    double frame_avg = static_cast<double>(keyframe_bytes + delta_bytes) / encoded;
+    double full_avg = static_cast<double>(full_payload) / encoded;
+    double delta_avg = static_cast<double>(delta_payload) / encoded;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n--- Frames ---" << std::endl;
+    std::cout << "Keyframes: " << keyframe_count << " avg "
+              << (keyframe_count ? static_cast<double>(keyframe_bytes) / keyframe_count : 0.0) << " B" << std::endl;
+    std::cout << "Deltas:    " << delta_count << " avg "
+              << (delta_count ? static_cast<double>(delta_bytes) / delta_count : 0.0) << " B" << std::endl;
+    std::cout << "All:       avg " << frame_avg << " B/sample, "
+              << full_avg / frame_avg << "x smaller than the RobotTelemetry payload" << std::endl;
+
+    std::cout << "\n--- Serialized samples (XCDRv2) ---" << std::endl;
+    std::cout << "RobotTelemetry:      " << full_avg << " B/sample" << std::endl;
+    std::cout << "RobotTelemetryDelta: " << delta_avg << " B/sample (" << full_avg / delta_avg << "x smaller)" << std::endl;
+    std::cout << "The id key and encapsulation are paid per DDS sample." << std::endl;
+
+    double batch_avg = static_cast<double>(batch_payload) / encoded;
+    std::cout << "\n--- Batched records (" << kBatchRobots << " robots per sample) ---" << std::endl;
+    std::cout << "Records:                  avg " << static_cast<double>(batch_bytes) / encoded << " B/sample" << std::endl;
+    std::cout << "RobotTelemetryDeltaBatch: " << batch_avg << " B/sample (" << full_avg / batch_avg
+              << "x smaller than RobotTelemetry)" << std::endl;
+    std::cout << "encode: " << nsPerSample(batch_encode_time, encoded) << " ns/sample | decode: "
+              << nsPerSample(batch_decode_time, batch_decoder.getKeyframes() + batch_decoder.getDeltas() + batch_decoder.getSkipped())
+              << " ns/record" << std::endl;
+    std::cout << "Delivered: " << batch_delivered << " | mismatches: " << batch_mismatches
+              << " | skipped waiting for a keyframe: " << batch_decoder.getSkipped()
+              << " | malformed: " << batch_decoder.getMalformed() << std::endl;
+
+    std::cout << "\n--- Cost ---" << std::endl;
+    std::cout << "encode: " << nsPerSample(encode_time, encoded) << " ns/sample" << std::endl;
+    std::cout << "decode: " << nsPerSample(decode_time, decoder.getKeyframes() + decoder.getDeltas() + decoder.getSkipped())
+              << " ns/frame" << std::endl;
+
+    std::cout << "\n--- Reconstruction ---" << std::endl;
+    std::cout << "Delivered: " << delivered << " | mismatches: " << mismatches << std::endl;
+    std::cout << "Skipped waiting for a keyframe: " << decoder.getSkipped() << " (" << decoder.getGaps() << " gaps)"
+              << " | malformed: " << decoder.getMalformed() << std::endl;
+
+    return mismatches == 0 && batch_mismatches == 0 ? 0 : 1;
+}
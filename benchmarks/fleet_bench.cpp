@@ -0,0 +1,156 @@
+// Fleet stepping benchmark: N separate RobotSimulator objects vs one FleetSimulator
+//
+// usage: fleet_bench [robots=10000] [ticks=200]
+//
+// "step" is update() alone. FleetSimulator evaluates the position and heading
+// of circular robots (and the heading of linear ones) when they are read, so
+// "step + fill" also fills a RobotTelemetry sample for every robot after each
+// tick, in both simulators: what a publisher of the whole fleet pays per tick.
+
+#include "RobotSimulator.hpp"
+#include "FleetSimulator.hpp"
+#include "BenchFleet.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // distance between two headings in [0, 2pi], 0 and 2pi being the same heading
+    double headingError(double a, double b)
+    {
+        double d = std::abs(a - b);
+        return std::min(d, 2 * M_PI - d);
+    }
+
+    // fills one reused sample per robot, returns the sum of the positions so
+    // the fills are not optimized away
+    double fillFleet(const std::vector<std::unique_ptr<RobotSimulator>>& simulators, RobotTelemetry& sample)
+    {
+        double sum = 0.0;
+        for (const auto& sim : simulators)
+        {
+            sim->fillTelemetry(sample);
+            sum += sample.x() + sample.y();
+        }
+        return sum;
+    }
+
+    double fillFleet(const FleetSimulator& fleet, RobotTelemetry& sample)
+    {
+        double sum = 0.0;
+        for (std::size_t i = 0; i < fleet.size(); i++)
+        {
+            fleet.fillTelemetry(i, sample);
+            sum += sample.x() + sample.y();
+        }
+        return sum;
+    }
+
+    double nsPerRobotTick(std::chrono::steady_clock::duration elapsed, std::size_t robots, int ticks)
+    {
+        double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        return ns / (static_cast<double>(robots) * ticks);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t robots = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000;
+    int ticks = argc > 2 ? std::atoi(argv[2]) : 200;
+    const double dt = 0.1;
+
+    std::cout << "=== Fleet simulator benchmark ===" << std::endl;
+    std::cout << "Robots: " << robots << " | Ticks: " << ticks << std::endl;
+    std::cout << "Kernels: " << SimdKernels::isaName(SimdKernels::detectIsa()) << std::endl;
+
+    // baseline: one heap allocated RobotSimulator per robot, same mix as the fleet
+    std::vector<std::unique_ptr<RobotSimulator>> simulators;
+    simulators.reserve(robots);
+    for (std::size_t i = 0; i < robots; i++)
+    {
+        simulators.emplace_back(new RobotSimulator("robo" + std::to_string(i)));
+        BenchFleet::configureRobot(*simulators.back(), i);
+    }
+
+    FleetSimulator fleet;
+    fleet.reserve(robots);
+    for (std::size_t i = 0; i < robots; i++)
+    {
+        fleet.addRobot("robo" + std::to_string(i));
+        BenchFleet::configureRobot(fleet, i);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < ticks; t++)
+    {
+        for (auto& sim : simulators)
+            sim->update(dt);
+    }
+    auto objects_elapsed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int t = 0; t < ticks; t++)
+    {
+        fleet.update(dt);
+    }
+    auto fleet_elapsed = std::chrono::steady_clock::now() - start;
+
+    // same number of ticks again, filling telemetry after each one
+    RobotTelemetry sample;
+    volatile double checksum = 0.0;
+    start = std::chrono::steady_clock::now();
+    for (int t = 0; t < ticks; t++)
+    {
+        for (auto& sim : simulators)
+            sim->update(dt);
+        checksum = checksum + fillFleet(simulators, sample);
+    }
+    auto objects_fill_elapsed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int t = 0; t < ticks; t++)
+    {
+        fleet.update(dt);
+        checksum = checksum - fillFleet(fleet, sample);
+    }
+    auto fleet_fill_elapsed = std::chrono::steady_clock::now() - start;
+
+    // both paths run the same models: identical with the scalar kernels,
+    // within the documented SimdKernels tolerance with the vector ones
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < robots; i++)
+    {
+        RobotTelemetry a = simulators[i]->generateTelemetry();
+        double position_tolerance = SimdKernels::kSinCosTolerance * (1.0 + std::abs(a.x()) + std::abs(a.y()));
+        if (std::abs(a.x() - fleet.getX(i)) > position_tolerance
+            || std::abs(a.y() - fleet.getY(i)) > position_tolerance
+            || headingError(a.orientation(), fleet.getOrientation(i))
+                > SimdKernels::orientationTolerance(fleet.getAngularVelocity(i) * fleet.getSimulationTime())
+            || a.battery_level() != fleet.getBatteryLevel(i))
+        {
+            mismatches++;
+        }
+    }
+
+    double objects_ns = nsPerRobotTick(objects_elapsed, robots, ticks);
+    double fleet_ns = nsPerRobotTick(fleet_elapsed, robots, ticks);
+    double objects_fill_ns = nsPerRobotTick(objects_fill_elapsed, robots, ticks);
+    double fleet_fill_ns = nsPerRobotTick(fleet_fill_elapsed, robots, ticks);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "                        step  step + fill  (ns/robot/tick)" << std::endl;
+    std::cout << "RobotSimulator x N: " << std::setw(8) << objects_ns << std::setw(12) << objects_fill_ns << std::endl;
+    std::cout << "FleetSimulator:     " << std::setw(8) << fleet_ns << std::setw(12) << fleet_fill_ns << std::endl;
+    std::cout << "Speedup:            " << std::setw(7) << objects_ns / fleet_ns << "x"
+              << std::setw(11) << objects_fill_ns / fleet_fill_ns << "x" << std::endl;
+    std::cout << "State mismatches:   " << mismatches << std::endl;
+
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,112 @@
+// Parallel fleet stepping benchmark: FleetStepper with 1..N threads
+//
+// usage: fleet_stepper_bench [robots=100000] [ticks=100] [max_threads=hardware]
+//
+// For each thread count it prints the tick wall time, the worker imbalance
+// and whether the final state is bit-identical to a single-threaded update().
+
+#include "FleetSimulator.hpp"
+#include "FleetStepper.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    void buildFleet(FleetSimulator& fleet, std::size_t robots)
+    {
+        fleet.reserve(robots);
+        for (std::size_t i = 0; i < robots; i++)
+        {
+            fleet.addRobot("robo" + std::to_string(i));
+            switch (i % 4)
+            {
+                case 0:
+                case 1:
+                    fleet.setCircularMotion(i, 5.0 + (i % 7), 0.1 + 1e-6 * i);
+                    break;
+                case 2:
+                    fleet.setLinearMotion(i, 1.0 + 0.1 * (i % 3), 0.3 * (i % 11));
+                    break;
+                case 3:
+                    fleet.setStationary(i, static_cast<double>(i % 100), static_cast<double>(i % 37));
+                    break;
+            }
+            fleet.setBatteryDrainRate(i, 0.1f + 0.05f * (i % 4));
+        }
+    }
+
+    bool sameBits(double a, double b)
+    {
+        return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+
+    bool identical(const FleetSimulator& a, const FleetSimulator& b)
+    {
+        for (std::size_t i = 0; i < a.size(); i++)
+        {
+            if (!sameBits(a.getX(i), b.getX(i)) || !sameBits(a.getY(i), b.getY(i))
+                || !sameBits(a.getOrientation(i), b.getOrientation(i))
+                || !sameBits(a.getSpeed(i), b.getSpeed(i))
+                || a.getBatteryLevel(i) != b.getBatteryLevel(i)
+                || a.isCharging(i) != b.isCharging(i))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t robots = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    int ticks = argc > 2 ? std::atoi(argv[2]) : 100;
+    std::size_t max_threads = argc > 3 ? std::strtoul(argv[3], nullptr, 10)
+                                       : std::max(1u, std::thread::hardware_concurrency());
+    const double dt = 0.1;
+
+    std::cout << "=== Parallel fleet stepping benchmark ===" << std::endl;
+    std::cout << "Robots: " << robots << " | Ticks: " << ticks
+              << " | Kernels: " << SimdKernels::isaName(SimdKernels::detectIsa()) << std::endl;
+
+    // reference: plain FleetSimulator::update()
+    FleetSimulator reference;
+    buildFleet(reference, robots);
+    for (int t = 0; t < ticks; t++)
+        reference.update(dt);
+
+    // 1, 2, 4, ... below max_threads, then max_threads itself
+    max_threads = std::max<std::size_t>(1, max_threads);
+    std::vector<std::size_t> thread_counts;
+    for (std::size_t threads = 1; threads < max_threads; threads *= 2)
+        thread_counts.push_back(threads);
+    thread_counts.push_back(max_threads);
+
+    bool all_identical = true;
+
+    for (std::size_t threads : thread_counts)
+    {
+        FleetSimulator fleet;
+        buildFleet(fleet, robots);
+
+        FleetStepper stepper(fleet, threads);
+        for (int t = 0; t < ticks; t++)
+            stepper.step(dt);
+
+        bool same = identical(reference, fleet);
+        all_identical = all_identical && same;
+
+        std::cout << std::endl;
+        stepper.printStats();
+        std::cout << "  - Bit-identical to update(): " << (same ? "yes" : "NO") << std::endl;
+    }
+
+    return all_identical ? 0 : 1;
+}
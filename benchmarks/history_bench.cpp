@@ -0,0 +1,150 @@
+// Telemetry history benchmark: ingest cost and range queries
+//
+// usage: history_bench [robots=1000] [minutes=10] [rate_hz=10]
+//
+// Feeds `minutes` of simulated telemetry for every robot (timestamps advance
+// by 1/rate_hz per tick), then times range queries on random robots: the raw
+// samples of the last 10 s and the 10 s / 1 min roll-ups of the last hour.
+// Roll-up means are checked against the raw samples of the same bucket.
+
+#include "TelemetryHistory.hpp"
+#include "RobotSimulator.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    double elapsedUs(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t robots = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000;
+    int minutes = argc > 2 ? std::atoi(argv[2]) : 10;
+    int rate_hz = argc > 3 ? std::max(1, std::atoi(argv[3])) : 10;
+
+    TelemetryHistory::Config config = TelemetryHistory::defaultConfig(robots);
+    TelemetryHistory history(config);
+
+    std::vector<RobotSimulator> simulators;
+    std::vector<std::string> ids;
+    for (std::size_t i = 0; i < robots; i++)
+    {
+        ids.push_back("robo" + std::to_string(i));
+        simulators.emplace_back(ids.back());
+        simulators.back().setCircularMotion(5.0, 0.2);
+    }
+
+    const uint64_t tick_ns = 1000000000ull / rate_hz;
+    const uint64_t ticks = static_cast<uint64_t>(minutes) * 60 * rate_hz;
+    uint64_t now = 1700000000ull * 1000000000ull;
+
+    RobotTelemetry telemetry;
+    double ingest_us = 0.0;
+    for (uint64_t tick = 0; tick < ticks; tick++)
+    {
+        now += tick_ns;
+        for (RobotSimulator& simulator : simulators)
+        {
+            simulator.update(1.0 / rate_hz);
+            simulator.fillTelemetry(telemetry);
+            telemetry.timestamp(now);
+
+            auto start = std::chrono::steady_clock::now();
+            history.append(telemetry);
+            ingest_us += elapsedUs(start);
+        }
+    }
+    uint64_t samples = ticks * robots;
+
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<std::size_t> pick(0, robots - 1);
+    const int queries = 10000;
+    const std::size_t battery = static_cast<std::size_t>(TelemetryHistory::Metric::BATTERY);
+
+    // raw: last 10 s
+    std::size_t raw_visited = 0;
+    double checksum = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (int q = 0; q < queries; q++)
+    {
+        raw_visited += history.visitRaw(ids[pick(rng)], now - 10 * 1000000000ull, now,
+            [&checksum, battery](const TelemetryHistory::RawSegment& segment)
+            {
+                for (std::size_t i = 0; i < segment.count; i++)
+                    checksum += segment.values[battery][i];
+            });
+    }
+    double raw_us = elapsedUs(start);
+
+    // roll-ups: last hour
+    std::size_t rollup_visited[TelemetryHistory::kTiers] = {0, 0, 0};
+    double rollup_us[TelemetryHistory::kTiers] = {0.0, 0.0, 0.0};
+    for (std::size_t t = 0; t < TelemetryHistory::kTiers; t++)
+    {
+        start = std::chrono::steady_clock::now();
+        for (int q = 0; q < queries; q++)
+        {
+            rollup_visited[t] += history.visitRollup(ids[pick(rng)], static_cast<TelemetryHistory::Tier>(t),
+                now - 3600 * 1000000000ull, now,
+                [&checksum, battery](const TelemetryHistory::RollupSegment& segment)
+                {
+                    for (std::size_t i = 0; i < segment.count; i++)
+                        checksum += segment.mean[battery][i];
+                });
+        }
+        rollup_us[t] = elapsedUs(start);
+    }
+
+    // the last complete 1 s bucket of robo0 must match its raw samples
+    uint64_t bucket = now - now % 1000000000ull - 1000000000ull;
+    double raw_sum = 0.0;
+    std::size_t raw_count = history.visitRaw(ids[0], bucket, bucket + 1000000000ull - 1,
+        [&raw_sum, battery](const TelemetryHistory::RawSegment& segment)
+        {
+            for (std::size_t i = 0; i < segment.count; i++)
+                raw_sum += segment.values[battery][i];
+        });
+    double rollup_mean = 0.0;
+    uint32_t rollup_count = 0;
+    history.visitRollup(ids[0], TelemetryHistory::Tier::SECOND, bucket, bucket,
+        [&](const TelemetryHistory::RollupSegment& segment)
+        {
+            rollup_mean = segment.mean[battery][0];
+            rollup_count = segment.samples[0];
+        });
+    bool consistent = raw_count == rollup_count && raw_count > 0
+        && std::fabs(raw_sum / raw_count - rollup_mean) < 1e-3;
+
+    std::cout << "=== Telemetry history benchmark (" << robots << " robots, "
+              << minutes << " min at " << rate_hz << " Hz) ===" << std::endl;
+    std::cout << std::fixed << std::setprecision(1)
+              << "Memory:        " << history.memoryBytes() / (1024.0 * 1024.0) << " MB ("
+              << TelemetryHistory::bytesPerRobot(config) / 1024.0 << " KB/robot, 50k robots: "
+              << 50000.0 * TelemetryHistory::bytesPerRobot(config) / (1024.0 * 1024.0 * 1024.0) << " GB)" << std::endl;
+    std::cout << "Ingest:        " << samples << " samples | "
+              << ingest_us * 1000.0 / samples << " ns/sample" << std::endl;
+    std::cout << "Raw (10 s):    " << raw_us * 1000.0 / queries << " ns/query | "
+              << raw_visited / queries << " samples/query" << std::endl;
+    for (std::size_t t = 0; t < TelemetryHistory::kTiers; t++)
+    {
+        std::cout << "Roll-up " << std::setw(5) << std::left
+                  << TelemetryHistory::tierName(static_cast<TelemetryHistory::Tier>(t)) << std::right
+                  << ": " << rollup_us[t] * 1000.0 / queries << " ns/query | "
+                  << rollup_visited[t] / queries << " buckets/query (last hour)" << std::endl;
+    }
+    std::cout << "Roll-up check: " << (consistent ? "OK" : "MISMATCH")
+              << " (" << raw_count << " samples) | checksum " << std::setprecision(0) << checksum << std::endl;
+
+    return consistent ? 0 : 1;
+}
@@ -0,0 +1,403 @@
+// Round-trip latency benchmark: ping -> echo -> pong for every QoS preset
+//
+// usage: latency_bench [--iterations N] [--sizes 16,64,255] [--profiles A,B,...]
+//                      [--udp] [--timeout-ms N] [--csv DIR]
+//
+// One-way latency needs synchronized clocks; a round trip only needs one.
+// The ping side writes RobotTelemetry on "latency_ping" with steady_clock ns
+// in `timestamp`, an echo participant writes the sample back unchanged on
+// "latency_pong", and the ping side takes now - timestamp when it arrives.
+// One ping is in flight at a time; a ping without pong after --timeout-ms
+// (default 200) counts as lost. All participants live in this process with
+// intraprocess delivery off, so samples go through the transport (SHM, or
+// UDPv4 with --udp) as between two processes on one box.
+//
+// Each QoSProfiles preset runs once per payload size: the id (the key) is
+// padded to the size. The key is serialized into a fixed 260 B buffer
+// (length + characters + terminator), so sizes are at most kMaxIdSize = 255
+// characters. DATA_SHARING runs once, RobotTelemetryPlain is fixed.
+// Percentiles are printed per run; DIR/latency_summary.csv (default DIR is
+// the current directory) gets one line per run and DIR/latency_<profile>_<size>.csv
+// the raw round trips, to compare builds.
+
+#include "RobotPublisher.hpp"
+#include "RobotSubscriber.hpp"
+#include "RobotSimulator.hpp"
+#include "QoSProfiles.hpp"
+#include "TelemetryConversions.hpp"
+#include <fastdds/LibrarySettings.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/stat.h>
+
+namespace
+{
+    const int kWarmup = 100;
+    // longest id RobotTelemetryPubSubType::compute_key can serialize
+    const std::size_t kMaxIdSize = 255;
+
+    struct Options
+    {
+        int iterations = 5000;
+        std::vector<std::size_t> sizes = {16, 64, 255};
+        std::vector<std::string> profiles;   // empty = all
+        bool udp = false;
+        int timeout_ms = 200;
+        std::string csv_directory = ".";
+    };
+
+    struct Profile
+    {
+        std::string name;
+        DataWriterQos writer_qos;
+        DataReaderQos reader_qos;
+        bool plain;
+    };
+
+    struct Result
+    {
+        std::string profile;
+        uint32_t payload_bytes;
+        std::size_t received;
+        std::size_t lost;
+        double min_us;
+        double mean_us;
+        double p50_us;
+        double p90_us;
+        double p99_us;
+        double p999_us;
+        double max_us;
+    };
+
+    std::vector<Profile> allProfiles()
+    {
+        return {
+            {"RELIABLE_TRANSIENT", QoSProfiles::getReliableTransientWriterQoS(), QoSProfiles::getReliableTransientReaderQoS(), false},
+            {"BEST_EFFORT", QoSProfiles::getBestEffortWriterQoS(), QoSProfiles::getBestEffortReaderQoS(), false},
+            {"RELIABLE_DEADLINE", QoSProfiles::getReliableWithDeadlineWriterQoS(), QoSProfiles::getReliableWithDeadlineReaderQoS(), false},
+            {"RELIABLE_LIFESPAN", QoSProfiles::getReliableWithLifespanWriterQoS(), QoSProfiles::getReliableWithLifespanReaderQoS(), false},
+            {"RELIABLE_KEEP_ALL", QoSProfiles::getReliableKeepAllWriterQoS(), QoSProfiles::getReliableKeepAllReaderQoS(), false},
+            {"DATA_SHARING", QoSProfiles::getDataSharingWriterQoS(), QoSProfiles::getDataSharingReaderQoS(), true},
+        };
+    }
+
+    std::vector<std::string> splitList(const std::string& list)
+    {
+        std::vector<std::string> items;
+        std::stringstream stream(list);
+        std::string item;
+        while (std::getline(stream, item, ','))
+        {
+            if (!item.empty())
+                items.push_back(item);
+        }
+        return items;
+    }
+
+    bool parseOptions(int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string arg = argv[i];
+            if (arg == "--iterations" && i + 1 < argc)
+                options.iterations = std::max(1, std::atoi(argv[++i]));
+            else if (arg == "--sizes" && i + 1 < argc)
+            {
+                options.sizes.clear();
+                for (const std::string& size : splitList(argv[++i]))
+                {
+                    std::size_t id_size = std::max<std::size_t>(1, std::strtoull(size.c_str(), nullptr, 10));
+                    if (id_size > kMaxIdSize)
+                    {
+                        std::cerr << "[Bench] --sizes: the id is the key, at most " << kMaxIdSize
+                                  << " characters (got " << id_size << ")" << std::endl;
+                        return false;
+                    }
+                    options.sizes.push_back(id_size);
+                }
+            }
+            else if (arg == "--profiles" && i + 1 < argc)
+                options.profiles = splitList(argv[++i]);
+            else if (arg == "--udp")
+                options.udp = true;
+            else if (arg == "--timeout-ms" && i + 1 < argc)
+                options.timeout_ms = std::max(1, std::atoi(argv[++i]));
+            else if (arg == "--csv" && i + 1 < argc)
+                options.csv_directory = argv[++i];
+            else
+                return false;
+        }
+        return !options.sizes.empty();
+    }
+
+    int64_t steadyNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    template<typename Sorted>
+    double percentileUs(const Sorted& sorted, double quantile)
+    {
+        std::size_t rank = static_cast<std::size_t>(quantile * sorted.size() + 0.5);
+        rank = std::min(std::max<std::size_t>(rank, 1), sorted.size());
+        return sorted[rank - 1] / 1000.0;
+    }
+
+    bool waitForMatch(RobotPublisher& publisher, RobotSubscriber& subscriber)
+    {
+        for (int i = 0; i < 100; i++)
+        {
+            if (publisher.getMatchedSubscribers() > 0 && subscriber.getMatchedPublishers() > 0)
+                return true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+        return false;
+    }
+
+    bool runProfile(const Profile& profile, std::size_t id_size, const Options& options,
+                    std::vector<int64_t>& rtts, Result& result)
+    {
+        DomainParticipantQos pqos = options.udp ? QoSProfiles::getUdpOnlyParticipantQoS() : PARTICIPANT_QOS_DEFAULT;
+
+        // pong -> ping side: the pong callback wakes the ping loop with the echoed timestamp
+        std::mutex pong_mutex;
+        std::condition_variable pong_cv;
+        int64_t pong_stamp = -1;
+        int64_t pong_ns = 0;
+
+        // readers are declared last so they go (and stop calling back) first
+        RobotPublisher ping_writer;
+        RobotPublisher echo_writer;
+        RobotSubscriber echo_reader;
+        RobotSubscriber pong_reader;
+        ping_writer.setTopicName("latency_ping");
+        echo_reader.setTopicName("latency_ping");
+        echo_writer.setTopicName("latency_pong");
+        pong_reader.setTopicName("latency_pong");
+
+        // ping -> echo: the echo side writes every ping straight back
+        echo_reader.setSampleCallback([&](const RobotTelemetry& ping, const SampleInfo&)
+        {
+            if (profile.plain)
+            {
+                echo_writer.publishPlain([&ping](RobotTelemetryPlain& pong)
+                {
+                    TelemetryConversions::toPlain(ping, pong);
+                });
+            }
+            else
+            {
+                echo_writer.publishLoaned([&ping](RobotTelemetry& pong)
+                {
+                    pong = ping;
+                });
+            }
+        });
+
+        pong_reader.setSampleCallback([&](const RobotTelemetry& pong, const SampleInfo&)
+        {
+            int64_t now = steadyNs();
+            {
+                std::lock_guard<std::mutex> lock(pong_mutex);
+                pong_stamp = static_cast<int64_t>(pong.timestamp());
+                pong_ns = now;
+            }
+            pong_cv.notify_one();
+        });
+
+        bool initialized = profile.plain
+            ? echo_reader.initPlain(profile.reader_qos, pqos) && echo_writer.initPlain(profile.writer_qos, pqos) &&
+              pong_reader.initPlain(profile.reader_qos, pqos) && ping_writer.initPlain(profile.writer_qos, pqos)
+            : echo_reader.init(profile.reader_qos, pqos) && echo_writer.init(profile.writer_qos, pqos) &&
+              pong_reader.init(profile.reader_qos, pqos) && ping_writer.init(profile.writer_qos, pqos);
+
+        if (!initialized || !waitForMatch(ping_writer, echo_reader) || !waitForMatch(echo_writer, pong_reader))
+        {
+            std::cerr << "[Bench] " << profile.name << ": setup or matching failed" << std::endl;
+            return false;
+        }
+
+        RobotSimulator simulator("robo003");
+        RobotTelemetry ping;
+        simulator.fillTelemetry(ping);
+        std::string id = ping.id();
+        id.resize(std::max(id.size(), id_size), 'x');
+        ping.id(id);
+
+        RobotTelemetryPlain plain_ping;
+        TelemetryConversions::toPlain(ping, plain_ping);
+        result.payload_bytes = profile.plain
+            ? RobotTelemetryPlainPubSubType().calculate_serialized_size(&plain_ping, XCDR2_DATA_REPRESENTATION)
+            : RobotTelemetryPubSubType().calculate_serialized_size(&ping, XCDR2_DATA_REPRESENTATION);
+
+        rtts.clear();
+        rtts.reserve(options.iterations);
+        std::size_t lost = 0;
+
+        for (int i = 0; i < kWarmup + options.iterations; i++)
+        {
+            int64_t stamp = steadyNs();
+            if (profile.plain)
+            {
+                plain_ping.timestamp(static_cast<uint64_t>(stamp));
+                ping_writer.publish(plain_ping);
+            }
+            else
+            {
+                ping.timestamp(static_cast<uint64_t>(stamp));
+                ping_writer.publish(ping);
+            }
+
+            std::unique_lock<std::mutex> lock(pong_mutex);
+            bool answered = pong_cv.wait_for(lock, std::chrono::milliseconds(options.timeout_ms),
+                                             [&]() { return pong_stamp == stamp; });
+            if (i < kWarmup)
+                continue;
+
+            if (answered)
+                rtts.push_back(pong_ns - stamp);
+            else
+                lost++;
+        }
+
+        ping_writer.stop();
+        echo_reader.stop();
+        pong_reader.stop();
+        echo_writer.stop();
+
+        result.profile = profile.name;
+        result.received = rtts.size();
+        result.lost = lost;
+        if (rtts.empty())
+        {
+            std::cerr << "[Bench] " << profile.name << ": no pong received" << std::endl;
+            return false;
+        }
+
+        std::vector<int64_t> sorted(rtts);
+        std::sort(sorted.begin(), sorted.end());
+        double sum = 0.0;
+        for (int64_t rtt : sorted)
+            sum += rtt;
+
+        result.min_us = sorted.front() / 1000.0;
+        result.mean_us = sum / sorted.size() / 1000.0;
+        result.p50_us = percentileUs(sorted, 0.50);
+        result.p90_us = percentileUs(sorted, 0.90);
+        result.p99_us = percentileUs(sorted, 0.99);
+        result.p999_us = percentileUs(sorted, 0.999);
+        result.max_us = sorted.back() / 1000.0;
+        return true;
+    }
+
+    void printResult(const Result& r)
+    {
+        std::cout << std::fixed << std::setprecision(1)
+                  << std::left << std::setw(20) << r.profile << std::right
+                  << " | " << std::setw(5) << r.payload_bytes << " B"
+                  << " | lost: " << std::setw(4) << r.lost
+                  << " | p50: " << std::setw(8) << r.p50_us << " us"
+                  << " | p90: " << std::setw(8) << r.p90_us << " us"
+                  << " | p99: " << std::setw(8) << r.p99_us << " us"
+                  << " | p99.9: " << std::setw(8) << r.p999_us << " us"
+                  << " | max: " << std::setw(9) << r.max_us << " us" << std::endl;
+    }
+
+    void writeSummaryLine(std::ostream& out, const Result& r)
+    {
+        out << std::fixed << std::setprecision(2)
+            << r.profile << ',' << r.payload_bytes << ',' << r.received << ',' << r.lost << ','
+            << r.min_us << ',' << r.mean_us << ',' << r.p50_us << ',' << r.p90_us << ','
+            << r.p99_us << ',' << r.p999_us << ',' << r.max_us << '\n';
+    }
+
+    void writeRunCsv(const std::string& directory, const Result& r, const std::vector<int64_t>& rtts)
+    {
+        std::string path = directory + "/latency_" + r.profile + "_" + std::to_string(r.payload_bytes) + ".csv";
+        std::ofstream out(path);
+        if (!out)
+        {
+            std::cerr << "[Bench] Cannot write " << path << std::endl;
+            return;
+        }
+
+        out << "iteration,rtt_ns\n";
+        for (std::size_t i = 0; i < rtts.size(); i++)
+            out << i << ',' << rtts[i] << '\n';
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        std::cerr << "usage: " << argv[0] << " [--iterations N] [--sizes 16,64,255] [--profiles A,B,...]"
+                  << " [--udp] [--timeout-ms N] [--csv DIR]" << std::endl;
+        return 1;
+    }
+
+    // in-process delivery would skip the transports
+    eprosima::fastdds::LibrarySettings settings;
+    settings.intraprocess_delivery = eprosima::fastdds::INTRAPROCESS_OFF;
+    DomainParticipantFactory::get_instance()->set_library_settings(settings);
+
+    ::mkdir(options.csv_directory.c_str(), 0755);
+    std::string summary_path = options.csv_directory + "/latency_summary.csv";
+    std::ofstream summary(summary_path);
+    if (!summary)
+    {
+        std::cerr << "[Bench] Cannot write " << summary_path << std::endl;
+        return 1;
+    }
+    summary << "profile,payload_bytes,received,lost,min_us,mean_us,p50_us,p90_us,p99_us,p999_us,max_us\n";
+
+    std::cout << "=== Round-trip latency benchmark (" << options.iterations << " pings per run, "
+              << (options.udp ? "UDPv4" : "default transports") << ") ===" << std::endl;
+
+    std::vector<Result> results;
+    std::vector<int64_t> rtts;
+    bool ok = true;
+
+    for (const Profile& profile : allProfiles())
+    {
+        if (!options.profiles.empty() &&
+            std::find(options.profiles.begin(), options.profiles.end(), profile.name) == options.profiles.end())
+            continue;
+
+        // the plain type has a fixed size
+        std::vector<std::size_t> sizes = profile.plain ? std::vector<std::size_t>{0} : options.sizes;
+        for (std::size_t size : sizes)
+        {
+            Result result;
+            if (!runProfile(profile, size, options, rtts, result))
+            {
+                ok = false;
+                continue;
+            }
+
+            results.push_back(result);
+            writeSummaryLine(summary, result);
+            writeRunCsv(options.csv_directory, result, rtts);
+        }
+    }
+
+    std::cout << std::endl;
+    for (const Result& result : results)
+        printResult(result);
+    std::cout << "CSV: " << summary_path << " (+ one file of round trips per run)" << std::endl;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,113 @@
+// Latency histogram benchmark: record() cost and percentile accuracy
+//
+// usage: latency_hist_bench [samples=5000000] [threads=2] [robots=1000]
+//
+// Samples come from a log-normal distribution around ~200 us with a tail
+// into the milliseconds (DDS latencies look like that). Each thread records
+// its share through LatencyTracker (profile + per-robot histogram) and the
+// reported percentiles are compared with the exact ones from a sorted copy.
+
+#include "LatencyTracker.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    double exactUs(const std::vector<int64_t>& sorted, double quantile)
+    {
+        std::size_t rank = static_cast<std::size_t>(quantile * sorted.size() + 0.5);
+        rank = std::max<std::size_t>(rank, 1);
+        return sorted[rank - 1] / 1000.0;
+    }
+
+    void printRow(const char* name, double exact, double reported)
+    {
+        std::cout << "  " << std::left << std::setw(6) << name << std::right << std::fixed << std::setprecision(1)
+                  << " | exact: " << std::setw(10) << exact << " us"
+                  << " | histogram: " << std::setw(10) << reported << " us"
+                  << " | error: " << std::setprecision(2) << std::setw(5) << 100.0 * (reported - exact) / exact << " %"
+                  << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t samples = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 5000000;
+    int threads = argc > 2 ? std::atoi(argv[2]) : 2;
+    std::size_t robots = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 1000;
+
+    std::cout << "=== Latency histogram benchmark (" << samples << " samples, " << threads << " threads, "
+              << robots << " robots) ===" << std::endl;
+
+    std::vector<std::string> ids(robots);
+    for (std::size_t i = 0; i < robots; i++)
+    {
+        // room for any size_t
+        char id[32];
+        std::snprintf(id, sizeof(id), "robot%05zu", i);
+        ids[i] = id;
+    }
+
+    std::vector<int64_t> latencies(samples);
+    std::mt19937_64 rng(42);
+    std::lognormal_distribution<double> distribution(std::log(200000.0), 0.6);
+    for (auto& latency : latencies)
+        latency = static_cast<int64_t>(distribution(rng));
+
+    LatencyTracker tracker("BENCH", robots);
+    std::cout << "Histogram size: " << sizeof(LatencyHistogram) / 1024.0 << " KB ("
+              << LatencyHistogram::kBuckets << " buckets)" << std::endl;
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&, t]()
+        {
+            for (std::size_t i = t; i < samples; i += threads)
+                tracker.record(ids[i % robots], latencies[i]);
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "record(): " << std::fixed << std::setprecision(1)
+              << elapsed.count() * 1e9 / samples << " ns/sample ("
+              << samples / elapsed.count() / 1e6 << " M samples/s over all threads)" << std::endl;
+
+    auto report_start = std::chrono::steady_clock::now();
+    tracker.report(std::cout, 3);
+    std::chrono::duration<double, std::milli> report_time = std::chrono::steady_clock::now() - report_start;
+    std::cout << "report(): " << report_time.count() << " ms" << std::endl;
+
+    std::sort(latencies.begin(), latencies.end());
+    LatencyHistogram::Summary summary = tracker.getProfileHistogram().summary();
+
+    std::cout << "Accuracy (profile histogram, " << summary.count << " samples):" << std::endl;
+    printRow("p50", exactUs(latencies, 0.50), summary.p50_us);
+    printRow("p99", exactUs(latencies, 0.99), summary.p99_us);
+    printRow("p99.9", exactUs(latencies, 0.999), summary.p999_us);
+    printRow("max", latencies.back() / 1000.0, summary.max_us);
+
+    bool ok = summary.count == samples;
+    const double quantiles[3] = {0.50, 0.99, 0.999};
+    const double reported[3] = {summary.p50_us, summary.p99_us, summary.p999_us};
+    for (int q = 0; q < 3; q++)
+    {
+        double exact = exactUs(latencies, quantiles[q]);
+        ok = ok && reported[q] >= exact && reported[q] <= exact * 1.02;
+    }
+    std::cout << "Within bucket resolution (+2 %): " << (ok ? "OK" : "FAILED") << std::endl;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,126 @@
+// Console logging benchmark: direct std::cout/std::endl vs AsyncLogger
+//
+// usage: logger_bench [records=200000] [log_every=1] > /dev/null   (or to a terminal)
+//
+// Times the producer side only, i.e. what the publish loop or reader thread
+// pays per received sample: the previous nine-line std::endl print vs
+// copying a TelemetryLog::Record into the logger ring. Summary goes to stderr.
+
+#include "AsyncLogger.hpp"
+#include "TelemetryLog.hpp"
+#include "RobotSimulator.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // what SubListener used to do on the DDS thread
+    void printDirect(const RobotTelemetry& telemetry, uint32_t count)
+    {
+        std::cout << "\n[Subscriber] Mesaj #" << count << " primit:" << std::endl;
+        std::cout << "  Robot ID:    " << telemetry.id() << std::endl;
+        std::cout << "  Poziție:     (" << std::fixed << std::setprecision(2)
+                  << telemetry.x() << ", " << telemetry.y() << ") m" << std::endl;
+        std::cout << "  Orientare:   " << telemetry.orientation() << " rad" << std::endl;
+        std::cout << "  Baterie:     " << telemetry.battery_level() << "%" << std::endl;
+        std::cout << "  Viteză:      " << telemetry.speed() << " m/s" << std::endl;
+        std::cout << "  Status:      " << RobotModels::statusName(telemetry.status()) << std::endl;
+        std::cout << "  Timestamp:   " << telemetry.timestamp() << " ns" << std::endl;
+        std::cout << std::string(50, '-') << std::endl;
+    }
+
+    struct Stats
+    {
+        double total_s;
+        double p50_ns;
+        double p99_ns;
+        double max_ns;
+    };
+
+    template<typename LogFn>
+    Stats measure(std::vector<RobotTelemetry>& samples, int records, LogFn log_fn)
+    {
+        std::vector<double> latencies;
+        latencies.reserve(records);
+
+        auto begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < records; i++)
+        {
+            const RobotTelemetry& telemetry = samples[i % samples.size()];
+            auto start = std::chrono::steady_clock::now();
+            log_fn(telemetry, static_cast<uint32_t>(i + 1));
+            latencies.push_back(std::chrono::duration<double, std::nano>(
+                std::chrono::steady_clock::now() - start).count());
+        }
+        std::chrono::duration<double> total = std::chrono::steady_clock::now() - begin;
+
+        std::sort(latencies.begin(), latencies.end());
+        Stats stats;
+        stats.total_s = total.count();
+        stats.p50_ns = latencies[latencies.size() / 2];
+        stats.p99_ns = latencies[latencies.size() * 99 / 100];
+        stats.max_ns = latencies.back();
+        return stats;
+    }
+
+    void printStats(const char* name, const Stats& s, int records)
+    {
+        std::cerr << std::fixed << std::setprecision(0)
+                  << std::left << std::setw(16) << name << std::right
+                  << " | " << std::setw(10) << records / s.total_s << " records/s"
+                  << " | p50: " << std::setw(7) << s.p50_ns << " ns"
+                  << " | p99: " << std::setw(7) << s.p99_ns << " ns"
+                  << " | max: " << std::setw(9) << s.max_ns << " ns" << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int records = argc > 1 ? std::atoi(argv[1]) : 200000;
+    uint32_t log_every = argc > 2 ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 1;
+
+    // 100 robots worth of samples
+    std::vector<RobotTelemetry> samples;
+    for (int i = 0; i < 100; i++)
+    {
+        RobotSimulator simulator("robo" + std::to_string(i));
+        simulator.setCircularMotion(5.0, 0.2);
+        simulator.update(0.1 * i);
+        samples.push_back(simulator.generateTelemetry());
+    }
+
+    Stats direct = measure(samples, records, [](const RobotTelemetry& telemetry, uint32_t count)
+    {
+        printDirect(telemetry, count);
+    });
+
+    AsyncLogger& logger = AsyncLogger::instance();
+    logger.setSampling(AsyncLogger::Category::TELEMETRY, log_every);
+    logger.start(1 << 16);
+
+    Stats async = measure(samples, records, [&logger](const RobotTelemetry& telemetry, uint32_t count)
+    {
+        if (logger.sample(AsyncLogger::Category::TELEMETRY, telemetry.id()))
+            logger.log(AsyncLogger::Category::TELEMETRY, &TelemetryLog::formatReceived,
+                       TelemetryLog::makeRecord(telemetry, count));
+    });
+
+    auto drain_start = std::chrono::steady_clock::now();
+    logger.stop();
+    std::chrono::duration<double> drain = std::chrono::steady_clock::now() - drain_start;
+
+    std::cerr << "\n=== Console logging benchmark (" << records << " records, log 1 in "
+              << log_every << " per robot) ===" << std::endl;
+    printStats("std::endl", direct, records);
+    printStats("AsyncLogger", async, records);
+    std::cerr << "AsyncLogger written: " << logger.getWritten()
+              << " | dropped (ring full): " << logger.getDropped()
+              << " | final drain: " << std::setprecision(1) << drain.count() * 1000.0 << " ms" << std::endl;
+
+    return 0;
+}
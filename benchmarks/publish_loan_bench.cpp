@@ -0,0 +1,147 @@
+// Publish path benchmark: generateTelemetry() + publish() vs publishLoaned()
+//
+// usage: publish_loan_bench [samples=100000]
+//
+// Counts heap allocations (global operator new) and measures the latency of
+// each publish call on both paths, with a BEST_EFFORT writer on domain 0.
+
+#include "RobotPublisher.hpp"
+#include "RobotSimulator.hpp"
+#include "QoSProfiles.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <vector>
+
+namespace
+{
+    std::atomic<uint64_t> g_allocations(0);
+}
+
+void* operator new(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    void* p = std::malloc(size == 0 ? 1 : size);
+    if (p == nullptr)
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace
+{
+    struct PathResult
+    {
+        double allocations_per_sample;
+        double mean_ns;
+        double p50_ns;
+        double p99_ns;
+        double max_ns;
+        int errors;
+    };
+
+    template<typename PublishFn>
+    PathResult measure(RobotSimulator& simulator, int samples, PublishFn publish_fn)
+    {
+        std::vector<double> latencies;
+        latencies.reserve(samples);
+        int errors = 0;
+
+        uint64_t allocations_before = g_allocations.load();
+
+        for (int i = 0; i < samples; i++)
+        {
+            simulator.update(0.1);
+
+            auto start = std::chrono::steady_clock::now();
+            if (!publish_fn())
+                errors++;
+            latencies.push_back(std::chrono::duration<double, std::nano>(
+                std::chrono::steady_clock::now() - start).count());
+        }
+
+        uint64_t allocations = g_allocations.load() - allocations_before;
+
+        std::sort(latencies.begin(), latencies.end());
+        double sum = 0.0;
+        for (double ns : latencies)
+            sum += ns;
+
+        PathResult result;
+        result.allocations_per_sample = static_cast<double>(allocations) / samples;
+        result.mean_ns = sum / samples;
+        result.p50_ns = latencies[latencies.size() / 2];
+        result.p99_ns = latencies[latencies.size() * 99 / 100];
+        result.max_ns = latencies.back();
+        result.errors = errors;
+        return result;
+    }
+
+    void printResult(const char* name, const PathResult& r)
+    {
+        std::cout << std::fixed << std::setprecision(2)
+                  << std::left << std::setw(22) << name << std::right
+                  << " | allocs/sample: " << std::setw(6) << r.allocations_per_sample
+                  << " | mean: " << std::setw(9) << r.mean_ns << " ns"
+                  << " | p50: " << std::setw(9) << r.p50_ns << " ns"
+                  << " | p99: " << std::setw(9) << r.p99_ns << " ns"
+                  << " | max: " << std::setw(10) << r.max_ns << " ns"
+                  << " | errors: " << r.errors << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int samples = argc > 1 ? std::atoi(argv[1]) : 100000;
+
+    std::cout << "=== Publish path benchmark (" << samples << " samples per path) ===" << std::endl;
+
+    RobotPublisher publisher;
+    if (!publisher.init(QoSProfiles::getBestEffortWriterQoS()))
+    {
+        std::cerr << "[Bench] Init error" << std::endl;
+        return 1;
+    }
+
+    RobotSimulator simulator("robo003");
+    simulator.setCircularMotion(5.0, 0.2);
+
+    // warm up both paths (writer history, first loan check)
+    for (int i = 0; i < 1000; i++)
+    {
+        RobotTelemetry telemetry = simulator.generateTelemetry();
+        publisher.publish(telemetry);
+        publisher.publishLoaned([&simulator](RobotTelemetry& sample) { simulator.fillTelemetry(sample); });
+    }
+
+    PathResult copy_path = measure(simulator, samples, [&]()
+    {
+        RobotTelemetry telemetry = simulator.generateTelemetry();
+        return publisher.publish(telemetry);
+    });
+
+    PathResult loan_path = measure(simulator, samples, [&]()
+    {
+        return publisher.publishLoaned([&simulator](RobotTelemetry& sample) { simulator.fillTelemetry(sample); });
+    });
+
+    std::cout << std::endl;
+    printResult("generate + publish", copy_path);
+    printResult("publishLoaned", loan_path);
+
+    publisher.stop();
+    return 0;
+}
@@ -0,0 +1,162 @@
+// Subscriber read path benchmark: listener callback vs WaitSet batch thread
+//
+// usage: reader_bench [seconds=5] [robots=16] [batch=256]
+//
+// A BEST_EFFORT publisher writes as fast as it can (intraprocess delivery
+// off, so samples go through the transport). For each read mode the
+// subscriber either only counts samples ("count") or formats the same nine
+// lines SubListener prints into a string stream ("format", the console
+// print without the terminal). Samples/sec received and the loss are shown.
+
+#include "RobotPublisher.hpp"
+#include "RobotSubscriber.hpp"
+#include "RobotSimulator.hpp"
+#include "RobotModels.hpp"
+#include "QoSProfiles.hpp"
+#include <fastdds/LibrarySettings.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct Result
+    {
+        uint64_t published;
+        uint32_t received;
+        double seconds;
+    };
+
+    void formatSample(const RobotTelemetry& telemetry, std::ostringstream& out)
+    {
+        out.str(std::string());
+        out << "\n[Subscriber] Mesaj primit:" << std::endl;
+        out << "  Robot ID:    " << telemetry.id() << std::endl;
+        out << "  Poziție:     (" << std::fixed << std::setprecision(2)
+            << telemetry.x() << ", " << telemetry.y() << ") m" << std::endl;
+        out << "  Orientare:   " << telemetry.orientation() << " rad" << std::endl;
+        out << "  Baterie:     " << telemetry.battery_level() << "%" << std::endl;
+        out << "  Viteză:      " << telemetry.speed() << " m/s" << std::endl;
+        out << "  Status:      " << RobotModels::statusName(telemetry.status()) << std::endl;
+        out << "  Timestamp:   " << telemetry.timestamp() << " ns" << std::endl;
+        out << std::string(50, '-') << std::endl;
+    }
+
+    bool runMode(RobotSubscriber::ReadMode mode, bool format, int seconds, int robots, int batch, Result& result)
+    {
+        DataWriterQos writer_qos = QoSProfiles::getBestEffortWriterQoS();
+        DataReaderQos reader_qos = QoSProfiles::getBestEffortReaderQoS();
+        reader_qos.history().depth = 32;
+        QoSProfiles::setPerRobotLimits(reader_qos);
+
+        std::ostringstream out;
+        RobotSubscriber subscriber;
+        subscriber.setReadMode(mode, batch);
+        subscriber.setSampleCallback([&out, format](const RobotTelemetry& telemetry, const SampleInfo&)
+        {
+            if (format)
+                formatSample(telemetry, out);
+        });
+
+        RobotPublisher publisher;
+        if (!subscriber.init(reader_qos, PARTICIPANT_QOS_DEFAULT)
+            || !publisher.init(writer_qos, PARTICIPANT_QOS_DEFAULT))
+        {
+            std::cerr << "[Bench] Init error" << std::endl;
+            return false;
+        }
+
+        for (int i = 0; i < 100 && (publisher.getMatchedSubscribers() == 0 || subscriber.getMatchedPublishers() == 0); i++)
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        std::vector<RobotSimulator> simulators;
+        for (int i = 0; i < robots; i++)
+        {
+            simulators.emplace_back("robo" + std::to_string(i));
+            simulators.back().setCircularMotion(5.0, 0.2);
+        }
+
+        uint64_t published = 0;
+        auto start = std::chrono::steady_clock::now();
+        auto end = start + std::chrono::seconds(seconds);
+
+        while (std::chrono::steady_clock::now() < end)
+        {
+            for (RobotSimulator& simulator : simulators)
+            {
+                simulator.update(0.1);
+                if (publisher.publishLoaned([&simulator](RobotTelemetry& sample) { simulator.fillTelemetry(sample); }))
+                    published++;
+            }
+        }
+
+        // let the reader drain what is already queued
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        publisher.stop();
+        subscriber.stop();
+
+        result.published = published;
+        result.received = subscriber.getTotalMessages();
+        result.seconds = elapsed.count();
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int seconds = argc > 1 ? std::atoi(argv[1]) : 5;
+    int robots = argc > 2 ? std::atoi(argv[2]) : 16;
+    int batch = argc > 3 ? std::atoi(argv[3]) : 256;
+
+    eprosima::fastdds::LibrarySettings settings;
+    settings.intraprocess_delivery = eprosima::fastdds::INTRAPROCESS_OFF;
+    DomainParticipantFactory::get_instance()->set_library_settings(settings);
+
+    std::cout << "=== Subscriber read path benchmark (" << seconds << " s per case, "
+              << robots << " robots, batch " << batch << ") ===" << std::endl;
+
+    struct Case
+    {
+        const char* name;
+        RobotSubscriber::ReadMode mode;
+        bool format;
+    };
+    const Case cases[] = {
+        {"LISTENER / count", RobotSubscriber::ReadMode::LISTENER, false},
+        {"WAITSET  / count", RobotSubscriber::ReadMode::WAITSET, false},
+        {"LISTENER / format", RobotSubscriber::ReadMode::LISTENER, true},
+        {"WAITSET  / format", RobotSubscriber::ReadMode::WAITSET, true},
+    };
+
+    std::vector<std::pair<const char*, Result>> results;
+    for (const Case& c : cases)
+    {
+        Result result;
+        if (!runMode(c.mode, c.format, seconds, robots, batch, result))
+            return 1;
+        results.emplace_back(c.name, result);
+    }
+
+    std::cout << std::endl;
+    for (const auto& entry : results)
+    {
+        const Result& r = entry.second;
+        double loss = r.published > 0 ? 100.0 * (1.0 - static_cast<double>(r.received) / r.published) : 0.0;
+        std::cout << std::fixed << std::setprecision(0)
+                  << std::left << std::setw(18) << entry.first << std::right
+                  << " | published: " << std::setw(10) << r.published / r.seconds << " /s"
+                  << " | received: " << std::setw(10) << r.received / r.seconds << " /s"
+                  << std::setprecision(1) << " | loss: " << std::setw(5) << loss << " %" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,166 @@
+// Telemetry recorder benchmark: ingest rate, read back and crash recovery
+//
+// usage: recorder_bench [records=5000000] [dir=/tmp/recorder_bench] [segment_records=1048576]
+//
+// 1. Records `records` samples of 1024 robots in a tight loop on one thread
+//    (the subscriber's ingest thread) and reports samples/s and stalls.
+// 2. Maps the segments back, checks the count and seeks by time.
+// 3. A forked child records 300000 samples and is killed with SIGKILL before
+//    stop(); the parent recovers the segments the child left behind.
+
+#include "TelemetryRecorder.hpp"
+#include "RobotSimulator.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <signal.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+    void clearDirectory(const std::string& directory)
+    {
+        mkdir(directory.c_str(), 0755);
+        for (const std::string& path : TelemetryRecording::listSegments(directory))
+            unlink(path.c_str());
+        TelemetryRecording::removePendingSegments(directory);
+    }
+
+    std::vector<RobotTelemetry> makeSamples()
+    {
+        std::vector<RobotTelemetry> samples;
+        for (int i = 0; i < 1024; i++)
+        {
+            RobotSimulator simulator("robo" + std::to_string(i));
+            simulator.setCircularMotion(5.0, 0.2);
+            simulator.update(0.1 * i);
+            samples.push_back(simulator.generateTelemetry());
+        }
+        return samples;
+    }
+
+    // total valid records, and how many segments were recovered by scanning
+    uint64_t readBack(const std::string& directory, uint64_t& segments, uint64_t& unclean)
+    {
+        uint64_t total = 0;
+        segments = 0;
+        unclean = 0;
+        for (const std::string& path : TelemetryRecording::listSegments(directory))
+        {
+            TelemetryRecording::SegmentReader reader;
+            if (!reader.open(path))
+            {
+                std::cerr << "[Bench] cannot open " << path << std::endl;
+                continue;
+            }
+            total += reader.size();
+            segments++;
+            unclean += reader.wasClosed() ? 0 : 1;
+        }
+        return total;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    uint64_t records = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 5000000;
+    std::string directory = argc > 2 ? argv[2] : "/tmp/recorder_bench";
+    uint64_t segment_records = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : (1 << 20);
+
+    std::vector<RobotTelemetry> samples = makeSamples();
+
+    TelemetryRecorder::Config config = TelemetryRecorder::defaultConfig(directory);
+    config.segment_records = segment_records;
+
+    // 1. ingest
+    clearDirectory(directory);
+    TelemetryRecorder recorder;
+    if (!recorder.start(config))
+        return 1;
+
+    std::vector<double> batch_ns;
+    batch_ns.reserve(records / 1000 + 1);
+    auto begin = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < records; i += 1000)
+    {
+        auto start = std::chrono::steady_clock::now();
+        uint64_t end = std::min<uint64_t>(records, i + 1000);
+        for (uint64_t j = i; j < end; j++)
+            recorder.record(samples[j & 1023]);
+        batch_ns.push_back(std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - start).count() / (end - i));
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+    recorder.stop();
+
+    std::sort(batch_ns.begin(), batch_ns.end());
+
+    // 2. read back
+    uint64_t segments = 0;
+    uint64_t unclean = 0;
+    uint64_t read = readBack(directory, segments, unclean);
+
+    bool seek_ok = true;
+    std::vector<std::string> paths = TelemetryRecording::listSegments(directory);
+    if (!paths.empty())
+    {
+        TelemetryRecording::SegmentReader reader;
+        reader.open(paths.front());
+        if (reader.size() > 0)
+        {
+            uint64_t target = reader.size() / 2;
+            uint64_t found = reader.seek(reader.record(target).recorded_ns);
+            seek_ok = found <= target && reader.record(found).recorded_ns == reader.record(target).recorded_ns;
+        }
+    }
+
+    // 3. crash: SIGKILL before stop()
+    std::string crash_directory = directory + "/crash";
+    clearDirectory(crash_directory);
+    const uint64_t crash_records = 300000;
+    TelemetryRecorder::Config crash_config = config;
+    crash_config.directory = crash_directory;
+    crash_config.segment_records = 131072;
+
+    pid_t child = fork();
+    if (child == 0)
+    {
+        TelemetryRecorder crashing;
+        if (!crashing.start(crash_config))
+            _exit(1);
+        for (uint64_t i = 0; i < crash_records; i++)
+            crashing.record(samples[i & 1023]);
+        kill(getpid(), SIGKILL);
+    }
+    int status = 0;
+    waitpid(child, &status, 0);
+
+    uint64_t crash_segments = 0;
+    uint64_t crash_unclean = 0;
+    uint64_t recovered = readBack(crash_directory, crash_segments, crash_unclean);
+
+    std::cout << "=== Telemetry recorder benchmark (" << records << " samples, "
+              << segment_records << " records/segment) ===" << std::endl;
+    std::cout << std::fixed << std::setprecision(0)
+              << "Ingest:     " << records / elapsed.count() << " samples/s"
+              << std::setprecision(1)
+              << " | p50: " << batch_ns[batch_ns.size() / 2] << " ns"
+              << " | p99: " << batch_ns[batch_ns.size() * 99 / 100] << " ns"
+              << " | max: " << batch_ns.back() << " ns (per sample, 1000-sample batches)" << std::endl;
+    std::cout << "Segments:   " << recorder.getSegments() << " | stalls: " << recorder.getStalls()
+              << " | dropped: " << recorder.getDropped() << std::endl;
+    std::cout << "Read back:  " << read << " / " << records << " records in " << segments
+              << " segments (" << unclean << " unclean) | seek: " << (seek_ok ? "OK" : "FAILED") << std::endl;
+    std::cout << "Crash test: " << recovered << " / " << crash_records << " records recovered from "
+              << crash_segments << " segments (" << crash_unclean << " not closed, killed: "
+              << (WIFSIGNALED(status) ? "yes" : "no") << ")" << std::endl;
+
+    return read == records && recovered == crash_records && seek_ok ? 0 : 1;
+}
@@ -0,0 +1,294 @@
+// CDR serialization micro-benchmarks (Google Benchmark)
+//
+// usage: serialization_bench [--benchmark_filter=REGEX] [--benchmark_format=csv] ...
+//
+// Covers what every write/read pays in the generated type support:
+// calculate_serialized_size, serialize, deserialize and compute_key (from
+// the sample on the writer, from the payload on the reader), for XCDRv1 and
+// XCDRv2. RobotTelemetry runs with realistic id lengths (the id is the key
+// and the only variable-size member, status is an enum): "robo003" (7),
+// a 15-char id (the longest RobotTelemetryPlain holds) and 40 chars
+// (hostname-style). RobotTelemetryPlain runs as the fixed-size reference.
+// Fast_* runs the same cases through RobotTelemetryFastPubSubType; its
+// serialize case first checks the bytes are identical to the generated ones.
+// Bytes/s is serialized bytes per second.
+
+#include "RobotSimulator.hpp"
+#include "RobotTelemetryFastPubSubType.hpp"
+#include "RobotTelemetryPubSubTypes.hpp"
+#include "RobotTelemetryPlainPubSubTypes.hpp"
+#include "TelemetryConversions.hpp"
+#include <benchmark/benchmark.h>
+#include <fastdds/rtps/common/InstanceHandle.hpp>
+#include <fastdds/rtps/common/SerializedPayload.hpp>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+using eprosima::fastdds::dds::DataRepresentationId_t;
+using SerializedPayload_t = eprosima::fastdds::rtps::SerializedPayload_t;
+using InstanceHandle_t = eprosima::fastdds::rtps::InstanceHandle_t;
+
+namespace
+{
+    const int64_t kIdLengths[] = {7, 15, 40};
+
+    DataRepresentationId_t representation(const benchmark::State& state, int arg)
+    {
+        return state.range(arg) == 1 ? DataRepresentationId_t::XCDR_DATA_REPRESENTATION
+                                     : DataRepresentationId_t::XCDR2_DATA_REPRESENTATION;
+    }
+
+    RobotTelemetry makeTelemetry(std::size_t id_length)
+    {
+        RobotSimulator simulator("robo003");
+        simulator.setCircularMotion(5.0, 0.2);
+        simulator.update(1.0);
+
+        RobotTelemetry telemetry;
+        simulator.fillTelemetry(telemetry);
+
+        std::string id = "robo003";
+        id.resize(id_length, 'x');
+        telemetry.id(id);
+        return telemetry;
+    }
+
+    RobotTelemetryPlain makePlain()
+    {
+        RobotTelemetryPlain plain;
+        TelemetryConversions::toPlain(makeTelemetry(7), plain);
+        return plain;
+    }
+
+    // RobotTelemetry: {id length, XCDR version}
+    void telemetryArgs(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgNames({"id", "xcdr"});
+        for (int64_t xcdr = 1; xcdr <= 2; xcdr++)
+        {
+            for (int64_t id_length : kIdLengths)
+                benchmark->Args({id_length, xcdr});
+        }
+    }
+
+    // RobotTelemetryPlain: {XCDR version}
+    void plainArgs(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgNames({"xcdr"});
+        benchmark->Arg(1);
+        benchmark->Arg(2);
+    }
+
+    // ------------------------------------------------------------------
+    // shared bodies, Type is the generated PubSubType
+    // ------------------------------------------------------------------
+
+    template<typename Type, typename Sample>
+    void calculateSize(benchmark::State& state, const Sample& sample, DataRepresentationId_t rep)
+    {
+        Type type;
+        for (auto _ : state)
+            benchmark::DoNotOptimize(type.calculate_serialized_size(&sample, rep));
+    }
+
+    template<typename Type, typename Sample>
+    void serialize(benchmark::State& state, const Sample& sample, DataRepresentationId_t rep)
+    {
+        Type type;
+        SerializedPayload_t payload(type.calculate_serialized_size(&sample, rep));
+        for (auto _ : state)
+        {
+            bool ok = type.serialize(&sample, payload, rep);
+            benchmark::DoNotOptimize(ok);
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * payload.length);
+    }
+
+    template<typename Type, typename Sample>
+    void deserialize(benchmark::State& state, const Sample& sample, DataRepresentationId_t rep)
+    {
+        Type type;
+        SerializedPayload_t payload(type.calculate_serialized_size(&sample, rep));
+        if (!type.serialize(&sample, payload, rep))
+        {
+            state.SkipWithError("serialize failed");
+            return;
+        }
+
+        Sample output;
+        for (auto _ : state)
+        {
+            bool ok = type.deserialize(payload, &output);
+            benchmark::DoNotOptimize(ok);
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * payload.length);
+    }
+
+    template<typename Type, typename Sample>
+    void computeKeyFromSample(benchmark::State& state, const Sample& sample)
+    {
+        Type type;
+        InstanceHandle_t handle;
+        for (auto _ : state)
+        {
+            bool ok = type.compute_key(&sample, handle, false);
+            benchmark::DoNotOptimize(ok);
+            benchmark::DoNotOptimize(handle);
+        }
+    }
+
+    template<typename Type, typename Sample>
+    void computeKeyFromPayload(benchmark::State& state, const Sample& sample, DataRepresentationId_t rep)
+    {
+        Type type;
+        SerializedPayload_t payload(type.calculate_serialized_size(&sample, rep));
+        if (!type.serialize(&sample, payload, rep))
+        {
+            state.SkipWithError("serialize failed");
+            return;
+        }
+
+        InstanceHandle_t handle;
+        for (auto _ : state)
+        {
+            bool ok = type.compute_key(payload, handle, false);
+            benchmark::DoNotOptimize(ok);
+            benchmark::DoNotOptimize(handle);
+        }
+    }
+
+    // the fast type support must produce the generated bytes, and read them back
+    bool sameWireFormat(const RobotTelemetry& sample, DataRepresentationId_t rep)
+    {
+        RobotTelemetryPubSubType generated;
+        RobotTelemetryFastPubSubType fast;
+        SerializedPayload_t expected(generated.calculate_serialized_size(&sample, rep));
+        SerializedPayload_t actual(fast.calculate_serialized_size(&sample, rep));
+        if (!generated.serialize(&sample, expected, rep) || !fast.serialize(&sample, actual, rep) ||
+            expected.length != actual.length || std::memcmp(expected.data, actual.data, expected.length) != 0)
+            return false;
+
+        RobotTelemetry decoded;
+        InstanceHandle_t expected_key;
+        InstanceHandle_t actual_key;
+        return fast.deserialize(expected, &decoded) && decoded == sample &&
+               generated.compute_key(&sample, expected_key) && fast.compute_key(expected, actual_key) &&
+               expected_key == actual_key;
+    }
+
+    // ------------------------------------------------------------------
+    // RobotTelemetry
+    // ------------------------------------------------------------------
+
+    void BM_Telemetry_CalculateSize(benchmark::State& state)
+    {
+        calculateSize<RobotTelemetryPubSubType>(state, makeTelemetry(state.range(0)), representation(state, 1));
+    }
+
+    void BM_Telemetry_Serialize(benchmark::State& state)
+    {
+        serialize<RobotTelemetryPubSubType>(state, makeTelemetry(state.range(0)), representation(state, 1));
+    }
+
+    void BM_Telemetry_Deserialize(benchmark::State& state)
+    {
+        deserialize<RobotTelemetryPubSubType>(state, makeTelemetry(state.range(0)), representation(state, 1));
+    }
+
+    void BM_Telemetry_ComputeKeySample(benchmark::State& state)
+    {
+        computeKeyFromSample<RobotTelemetryPubSubType>(state, makeTelemetry(state.range(0)));
+    }
+
+    void BM_Telemetry_ComputeKeyPayload(benchmark::State& state)
+    {
+        computeKeyFromPayload<RobotTelemetryPubSubType>(state, makeTelemetry(state.range(0)), representation(state, 1));
+    }
+
+    // ------------------------------------------------------------------
+    // RobotTelemetry, fixed-layout type support
+    // ------------------------------------------------------------------
+
+    void BM_Fast_CalculateSize(benchmark::State& state)
+    {
+        calculateSize<RobotTelemetryFastPubSubType>(state, makeTelemetry(state.range(0)), representation(state, 1));
+    }
+
+    void BM_Fast_Serialize(benchmark::State& state)
+    {
+        RobotTelemetry sample = makeTelemetry(state.range(0));
+        if (!sameWireFormat(sample, representation(state, 1)))
+        {
+            state.SkipWithError("output differs from the generated type support");
+            return;
+        }
+        serialize<RobotTelemetryFastPubSubType>(state, sample, representation(state, 1));
+    }
+
+    void BM_Fast_Deserialize(benchmark::State& state)
+    {
+        deserialize<RobotTelemetryFastPubSubType>(state, makeTelemetry(state.range(0)), representation(state, 1));
+    }
+
+    void BM_Fast_ComputeKeySample(benchmark::State& state)
+    {
+        computeKeyFromSample<RobotTelemetryFastPubSubType>(state, makeTelemetry(state.range(0)));
+    }
+
+    void BM_Fast_ComputeKeyPayload(benchmark::State& state)
+    {
+        computeKeyFromPayload<RobotTelemetryFastPubSubType>(state, makeTelemetry(state.range(0)), representation(state, 1));
+    }
+
+    // ------------------------------------------------------------------
+    // RobotTelemetryPlain
+    // ------------------------------------------------------------------
+
+    void BM_Plain_CalculateSize(benchmark::State& state)
+    {
+        calculateSize<RobotTelemetryPlainPubSubType>(state, makePlain(), representation(state, 0));
+    }
+
+    void BM_Plain_Serialize(benchmark::State& state)
+    {
+        serialize<RobotTelemetryPlainPubSubType>(state, makePlain(), representation(state, 0));
+    }
+
+    void BM_Plain_Deserialize(benchmark::State& state)
+    {
+        deserialize<RobotTelemetryPlainPubSubType>(state, makePlain(), representation(state, 0));
+    }
+
+    void BM_Plain_ComputeKeySample(benchmark::State& state)
+    {
+        computeKeyFromSample<RobotTelemetryPlainPubSubType>(state, makePlain());
+    }
+
+    void BM_Plain_ComputeKeyPayload(benchmark::State& state)
+    {
+        computeKeyFromPayload<RobotTelemetryPlainPubSubType>(state, makePlain(), representation(state, 0));
+    }
+}
+
+BENCHMARK(BM_Telemetry_CalculateSize)->Apply(telemetryArgs);
+BENCHMARK(BM_Telemetry_Serialize)->Apply(telemetryArgs);
+BENCHMARK(BM_Telemetry_Deserialize)->Apply(telemetryArgs);
+BENCHMARK(BM_Telemetry_ComputeKeySample)->Apply(telemetryArgs);
+BENCHMARK(BM_Telemetry_ComputeKeyPayload)->Apply(telemetryArgs);
+
+BENCHMARK(BM_Fast_CalculateSize)->Apply(telemetryArgs);
+BENCHMARK(BM_Fast_Serialize)->Apply(telemetryArgs);
+BENCHMARK(BM_Fast_Deserialize)->Apply(telemetryArgs);
+BENCHMARK(BM_Fast_ComputeKeySample)->Apply(telemetryArgs);
+BENCHMARK(BM_Fast_ComputeKeyPayload)->Apply(telemetryArgs);
+
+BENCHMARK(BM_Plain_CalculateSize)->Apply(plainArgs);
+BENCHMARK(BM_Plain_Serialize)->Apply(plainArgs);
+BENCHMARK(BM_Plain_Deserialize)->Apply(plainArgs);
+BENCHMARK(BM_Plain_ComputeKeySample)->Apply(plainArgs);
+BENCHMARK(BM_Plain_ComputeKeyPayload)->Apply(plainArgs);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,125 @@
+// SIMD kernel benchmark: FleetSimulator with scalar vs AVX2 kernels
+//
+// usage: simd_bench [robots=100000] [ticks=100]
+//
+// Two fleets are measured: "shared" (5 distinct angular velocities, so the
+// phase is computed for 5 groups only) and "unique" (every circular robot has
+// its own angular velocity, one sincos per robot - the worst case).
+
+#include "FleetSimulator.hpp"
+#include "SimdKernels.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace
+{
+    void buildFleet(FleetSimulator& fleet, std::size_t robots, bool unique_phase)
+    {
+        fleet.reserve(robots);
+        for (std::size_t i = 0; i < robots; i++)
+        {
+            fleet.addRobot("robo" + std::to_string(i));
+
+            double w = unique_phase ? 0.1 + 1e-6 * i : 0.2 + 0.01 * (i % 5);
+            switch (i % 4)
+            {
+                case 0:
+                case 1:
+                    fleet.setCircularMotion(i, 5.0 + (i % 7), w);
+                    break;
+                case 2:
+                    fleet.setLinearMotion(i, 1.0 + 0.1 * (i % 3), 0.3 * (i % 11));
+                    break;
+                case 3:
+                    fleet.setStationary(i, static_cast<double>(i % 100), static_cast<double>(i % 37));
+                    break;
+            }
+            fleet.setBatteryDrainRate(i, 0.1f + 0.05f * (i % 4));
+        }
+    }
+
+    double robotsPerSecond(FleetSimulator& fleet, int ticks)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int t = 0; t < ticks; t++)
+            fleet.update(0.1);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        return static_cast<double>(fleet.size()) * ticks / elapsed.count();
+    }
+
+    // distance between two headings in [0, 2pi], 0 and 2pi being the same heading
+    double headingError(double a, double b)
+    {
+        double d = std::abs(a - b);
+        return std::min(d, 2 * M_PI - d);
+    }
+
+    // returns the number of robots outside the documented tolerance
+    std::size_t runCase(const char* name, std::size_t robots, int ticks, bool unique_phase)
+    {
+        FleetSimulator scalar;
+        FleetSimulator simd;
+        buildFleet(scalar, robots, unique_phase);
+        buildFleet(simd, robots, unique_phase);
+        scalar.setKernelIsa(SimdKernels::Isa::SCALAR);
+        simd.setKernelIsa(SimdKernels::detectIsa());
+
+        double scalar_rate = robotsPerSecond(scalar, ticks);
+        double simd_rate = robotsPerSecond(simd, ticks);
+
+        double max_position_error = 0.0;
+        double max_orientation_error = 0.0;
+        std::size_t orientation_mismatches = 0;
+        std::size_t battery_mismatches = 0;
+        for (std::size_t i = 0; i < robots; i++)
+        {
+            max_position_error = std::max(max_position_error, std::abs(scalar.getX(i) - simd.getX(i)));
+            max_position_error = std::max(max_position_error, std::abs(scalar.getY(i) - simd.getY(i)));
+            double heading_error = headingError(scalar.getOrientation(i), simd.getOrientation(i));
+            max_orientation_error = std::max(max_orientation_error, heading_error);
+            if (heading_error > SimdKernels::orientationTolerance(scalar.getAngularVelocity(i) * scalar.getSimulationTime()))
+                orientation_mismatches++;
+            if (scalar.getBatteryLevel(i) != simd.getBatteryLevel(i)
+                || scalar.isCharging(i) != simd.isCharging(i))
+            {
+                battery_mismatches++;
+            }
+        }
+
+        std::cout << "\n--- " << name << " ---" << std::endl;
+        std::cout << std::scientific << std::setprecision(3);
+        std::cout << "SCALAR: " << scalar_rate << " robots/s" << std::endl;
+        std::cout << std::setw(6) << SimdKernels::isaName(simd.getKernelIsa()) << ": "
+                  << simd_rate << " robots/s" << std::endl;
+        std::cout << std::fixed << std::setprecision(2)
+                  << "Speedup: " << simd_rate / scalar_rate << "x" << std::endl;
+        std::cout << std::scientific << std::setprecision(3)
+                  << "Max position error:    " << max_position_error << " m" << std::endl;
+        std::cout << "Max orientation error: " << max_orientation_error << " rad" << std::endl;
+        std::cout << "Out of tolerance:      " << orientation_mismatches << std::endl;
+        std::cout << "Battery mismatches:    " << battery_mismatches << std::endl;
+
+        return orientation_mismatches + battery_mismatches;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t robots = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    int ticks = argc > 2 ? std::atoi(argv[2]) : 100;
+
+    std::cout << "=== SIMD kernel benchmark ===" << std::endl;
+    std::cout << "Robots: " << robots << " | Ticks: " << ticks
+              << " | CPU kernels: " << SimdKernels::isaName(SimdKernels::detectIsa()) << std::endl;
+
+    std::size_t failures = runCase("shared angular velocities", robots, ticks, false);
+    failures += runCase("unique angular velocities", robots, ticks, true);
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,208 @@
+// Startup benchmark: time to first sample with multicast vs static-peer discovery
+//
+// usage: startup_bench [--runs N] [--timeout-ms N] [--peers a.b.c.d,...]
+//
+// Emulates launching a subscriber and a publisher together: each run starts
+// from no participant, creates the subscriber, then the publisher, waits for
+// the match with RobotPublisher::waitForMatch() (no fixed sleep) and writes
+// one sample. Per run it takes, from the start:
+//   - created: both participants, topics and endpoints created
+//   - matched: the publisher's listener saw the subscriber
+//   - first:   the subscriber's callback got the sample
+// for two participant setups:
+//   - multicast:    PARTICIPANT_QOS_DEFAULT, SPDP over multicast, Fast DDS
+//                   announcement periods (what the mains used before --peers)
+//   - static-peers: QoSProfiles::getStaticPeersParticipantQoS(--peers, default
+//                   127.0.0.1), unicast SPDP with the fast announcement burst
+// --runs (default 20) runs per setup, a run without a first sample after
+// --timeout-ms (default 10000) fails. Intraprocess delivery is off, so
+// discovery and the sample go through the transports, on loopback. The old
+// publisher main slept 2000 ms before its first sample, whatever the setup.
+
+#include "RobotPublisher.hpp"
+#include "RobotSubscriber.hpp"
+#include "RobotSimulator.hpp"
+#include "QoSProfiles.hpp"
+#include <fastdds/LibrarySettings.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Options
+    {
+        int runs = 20;
+        int timeout_ms = 10000;
+        std::vector<std::string> peers = {"127.0.0.1"};
+    };
+
+    struct Setup
+    {
+        std::string name;
+        DomainParticipantQos pqos;
+    };
+
+    // ms from the start of a run
+    struct Run
+    {
+        double created;
+        double matched;
+        double first;
+    };
+
+    bool parseOptions(int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string arg = argv[i];
+            if (arg == "--runs" && i + 1 < argc)
+                options.runs = std::max(1, std::atoi(argv[++i]));
+            else if (arg == "--timeout-ms" && i + 1 < argc)
+                options.timeout_ms = std::max(1, std::atoi(argv[++i]));
+            else if (arg == "--peers" && i + 1 < argc)
+                options.peers = QoSProfiles::splitPeers(argv[++i]);
+            else
+                return false;
+        }
+        return !options.peers.empty();
+    }
+
+    double msSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    bool runOnce(const Setup& setup, const Options& options, Run& run)
+    {
+        std::mutex mutex;
+        std::condition_variable received_cv;
+        bool received = false;
+        std::chrono::steady_clock::time_point received_at;
+
+        auto start = std::chrono::steady_clock::now();
+
+        RobotPublisher publisher;
+        RobotSubscriber subscriber;
+        publisher.setTopicName("startup_bench");
+        subscriber.setTopicName("startup_bench");
+        subscriber.setSampleCallback([&](const RobotTelemetry&, const SampleInfo&)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!received)
+            {
+                received = true;
+                received_at = std::chrono::steady_clock::now();
+                received_cv.notify_one();
+            }
+        });
+
+        if (!subscriber.init(QoSProfiles::getReliableTransientReaderQoS(), setup.pqos) ||
+            !publisher.init(QoSProfiles::getReliableTransientWriterQoS(), setup.pqos))
+        {
+            std::cerr << "[Bench] " << setup.name << ": setup failed" << std::endl;
+            return false;
+        }
+        run.created = msSince(start);
+
+        if (!publisher.waitForMatch(options.timeout_ms))
+        {
+            std::cerr << "[Bench] " << setup.name << ": no match after " << options.timeout_ms << " ms" << std::endl;
+            return false;
+        }
+        run.matched = msSince(start);
+
+        RobotSimulator simulator("robo003");
+        publisher.publishLoaned([&simulator](RobotTelemetry& sample) { simulator.fillTelemetry(sample); });
+
+        bool ok;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            ok = received_cv.wait_until(lock, start + std::chrono::milliseconds(options.timeout_ms),
+                                        [&received]() { return received; });
+        }
+        if (ok)
+            run.first = std::chrono::duration<double, std::milli>(received_at - start).count();
+        else
+            std::cerr << "[Bench] " << setup.name << ": no sample after " << options.timeout_ms << " ms" << std::endl;
+
+        publisher.stop();
+        subscriber.stop();
+        return ok;
+    }
+
+    double percentile(std::vector<double> values, double quantile)
+    {
+        std::sort(values.begin(), values.end());
+        std::size_t rank = static_cast<std::size_t>(quantile * values.size() + 0.5);
+        rank = std::min(std::max<std::size_t>(rank, 1), values.size());
+        return values[rank - 1];
+    }
+
+    void printPhase(const char* name, const std::vector<double>& values)
+    {
+        std::cout << "  " << std::left << std::setw(9) << name << std::right << std::fixed << std::setprecision(1)
+                  << " p50 " << std::setw(8) << percentile(values, 0.50) << " ms"
+                  << " | p90 " << std::setw(8) << percentile(values, 0.90) << " ms"
+                  << " | max " << std::setw(8) << percentile(values, 1.0) << " ms" << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        std::cerr << "usage: " << argv[0] << " [--runs N] [--timeout-ms N] [--peers a.b.c.d,...]" << std::endl;
+        return 1;
+    }
+
+    // in-process delivery would skip the transports
+    eprosima::fastdds::LibrarySettings settings;
+    settings.intraprocess_delivery = eprosima::fastdds::INTRAPROCESS_OFF;
+    DomainParticipantFactory::get_instance()->set_library_settings(settings);
+
+    std::cout << "=== Startup benchmark (" << options.runs << " runs per setup) ===" << std::endl;
+
+    const std::vector<Setup> setups = {
+        {"multicast", PARTICIPANT_QOS_DEFAULT},
+        {"static-peers", QoSProfiles::getStaticPeersParticipantQoS(options.peers)},
+    };
+
+    bool ok = true;
+    for (const Setup& setup : setups)
+    {
+        std::vector<double> created;
+        std::vector<double> matched;
+        std::vector<double> first;
+        for (int i = 0; i < options.runs; i++)
+        {
+            Run run;
+            if (!runOnce(setup, options, run))
+            {
+                ok = false;
+                continue;
+            }
+            created.push_back(run.created);
+            matched.push_back(run.matched);
+            first.push_back(run.first);
+        }
+
+        std::cout << "\n" << setup.name << ": " << first.size() << "/" << options.runs << " runs" << std::endl;
+        if (first.empty())
+            continue;
+        printPhase("created", created);
+        printPhase("matched", matched);
+        printPhase("first", first);
+    }
+
+    std::cout << "\n(the publisher main used to sleep 2000 ms before its first sample)" << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,158 @@
+// Per-robot state store benchmark: one ingest thread vs concurrent readers
+//
+// usage: state_store_bench [robots=100000] [seconds=3] [readers=2]
+//
+// The ingest thread updates the robots round robin as fast as it can (the
+// subscriber's listener/WaitSet thread). Reader 0 takes full-fleet snapshots
+// in a loop (the dashboard), the other readers look up random robots by id.
+// Every update writes x == y, so a reader seeing x != y would be a torn read.
+
+#include "RobotStateStore.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct ReaderResult
+    {
+        uint64_t operations;
+        uint64_t torn;
+        double total_us;
+        double max_us;
+    };
+
+    double elapsedUs(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t robots = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    int seconds = argc > 2 ? std::atoi(argv[2]) : 3;
+    int readers = argc > 3 ? std::max(1, std::atoi(argv[3])) : 2;
+
+    std::vector<RobotTelemetry> samples(robots);
+    std::vector<std::string> ids(robots);
+    for (std::size_t i = 0; i < robots; i++)
+    {
+        ids[i] = "robo" + std::to_string(i);
+        samples[i].id(ids[i]);
+        samples[i].battery_level(100.0f);
+        samples[i].status(RobotStatus::IDLE);
+    }
+
+    RobotStateStore store(robots);
+
+    // first update of every robot (inserts)
+    auto insert_start = std::chrono::steady_clock::now();
+    for (const RobotTelemetry& sample : samples)
+        store.update(sample);
+    double insert_us = elapsedUs(insert_start);
+
+    std::atomic<bool> running(true);
+    std::vector<ReaderResult> results(readers, ReaderResult{0, 0, 0.0, 0.0});
+    std::vector<std::thread> threads;
+
+    for (int r = 0; r < readers; r++)
+    {
+        threads.emplace_back([&, r]()
+        {
+            ReaderResult& result = results[r];
+            std::vector<RobotStateStore::RobotState> fleet;
+            RobotStateStore::RobotState state;
+            std::mt19937 rng(r);
+            std::uniform_int_distribution<std::size_t> pick(0, robots - 1);
+
+            while (running.load(std::memory_order_relaxed))
+            {
+                auto start = std::chrono::steady_clock::now();
+                if (r == 0)
+                {
+                    store.snapshot(fleet);
+                    for (const RobotStateStore::RobotState& robot : fleet)
+                        result.torn += robot.x != robot.y;
+                }
+                else
+                {
+                    for (int i = 0; i < 1000; i++)
+                    {
+                        store.get(ids[pick(rng)], state);
+                        result.torn += state.x != state.y;
+                    }
+                }
+                double us = elapsedUs(start);
+                result.total_us += us;
+                result.max_us = std::max(result.max_us, us);
+                result.operations += r == 0 ? 1 : 1000;
+            }
+        });
+    }
+
+    uint64_t updates = 0;
+    auto start = std::chrono::steady_clock::now();
+    auto end = start + std::chrono::seconds(seconds);
+    double value = 0.0;
+    while (std::chrono::steady_clock::now() < end)
+    {
+        for (int batch = 0; batch < 1024; batch++)
+        {
+            RobotTelemetry& sample = samples[updates % robots];
+            value += 1.0;
+            sample.x(value);
+            sample.y(value);
+            store.update(sample);
+            updates++;
+        }
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    running = false;
+    for (std::thread& thread : threads)
+        thread.join();
+
+    std::cout << "=== Robot state store benchmark (" << robots << " robots, "
+              << readers << " readers, " << seconds << " s) ===" << std::endl;
+    std::cout << std::fixed << std::setprecision(1)
+              << "Memory:        " << store.memoryBytes() / (1024.0 * 1024.0) << " MB ("
+              << store.memoryBytes() / robots << " B/robot)" << std::endl;
+    std::cout << "First insert:  " << insert_us * 1000.0 / robots << " ns/robot" << std::endl;
+    std::cout << std::setprecision(0)
+              << "Updates:       " << updates / elapsed.count() << " /s ("
+              << std::setprecision(1) << elapsed.count() * 1e9 / updates << " ns/update)" << std::endl;
+
+    const ReaderResult& snapshots = results[0];
+    if (snapshots.operations > 0)
+    {
+        std::cout << "Snapshots:     " << snapshots.operations
+                  << " | avg: " << std::setprecision(2) << snapshots.total_us / snapshots.operations / 1000.0 << " ms"
+                  << " | max: " << snapshots.max_us / 1000.0 << " ms" << std::endl;
+    }
+
+    uint64_t lookups = 0;
+    double lookup_us = 0.0;
+    uint64_t torn = snapshots.torn;
+    for (int r = 1; r < readers; r++)
+    {
+        lookups += results[r].operations;
+        lookup_us += results[r].total_us;
+        torn += results[r].torn;
+    }
+    if (lookups > 0)
+    {
+        std::cout << "Lookups:       " << std::setprecision(0) << lookups / elapsed.count() << " /s ("
+                  << std::setprecision(1) << lookup_us * 1000.0 / lookups << " ns/lookup)" << std::endl;
+    }
+    std::cout << "Torn reads:    " << torn << " | rejected: " << store.getRejected() << std::endl;
+
+    return torn == 0 ? 0 : 1;
+}
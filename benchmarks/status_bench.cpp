@@ -0,0 +1,185 @@
+// Status field benchmark: string status (previous RobotTelemetry) vs RobotStatus enum
+//
+// usage: status_bench [samples=1000000]
+//
+// The string variant is serialized exactly as the previous generated code did
+// (XCDRv2, DELIMIT_CDR2, status as a CDR string built from a new std::string
+// every tick). Per sample it measures: status encoding, serialize, deserialize
+// and a downstream "is it LOW_BATTERY" check, plus the serialized sizes.
+
+#include "RobotSimulator.hpp"
+#include "RobotModels.hpp"
+#include "RobotTelemetryPubSubTypes.hpp"
+#include "RobotTelemetryCdrAux.hpp"
+#include <fastcdr/Cdr.h>
+#include <fastcdr/FastBuffer.h>
+#include <fastdds/rtps/common/SerializedPayload.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace eprosima::fastcdr;
+using SerializedPayload_t = eprosima::fastdds::rtps::SerializedPayload_t;
+
+namespace
+{
+    // max CDR size of RobotTelemetry with `string status` (from the previous RobotTelemetryCdrAux.hpp)
+    const uint32_t kStringStatusMaxCdrSize = 576;
+
+    struct StringStatusTelemetry
+    {
+        std::string id;
+        double x;
+        double y;
+        double orientation;
+        float battery_level;
+        double speed;
+        std::string status;
+        uint64_t timestamp;
+    };
+
+    bool serializeStringStatus(const RobotTelemetry& t, const std::string& status, SerializedPayload_t& payload)
+    {
+        FastBuffer buffer(reinterpret_cast<char*>(payload.data), payload.max_size);
+        Cdr ser(buffer, Cdr::DEFAULT_ENDIAN, CdrVersion::XCDRv2);
+        ser.set_encoding_flag(EncodingAlgorithmFlag::DELIMIT_CDR2);
+
+        try
+        {
+            ser.serialize_encapsulation();
+            Cdr::state current_state(ser);
+            ser.begin_serialize_type(current_state, EncodingAlgorithmFlag::DELIMIT_CDR2);
+            ser << MemberId(0) << t.id()
+                << MemberId(1) << t.x()
+                << MemberId(2) << t.y()
+                << MemberId(3) << t.orientation()
+                << MemberId(4) << t.battery_level()
+                << MemberId(5) << t.speed()
+                << MemberId(6) << status
+                << MemberId(7) << t.timestamp();
+            ser.end_serialize_type(current_state);
+        }
+        catch (exception::Exception&)
+        {
+            return false;
+        }
+
+        payload.length = static_cast<uint32_t>(ser.get_serialized_data_length());
+        return true;
+    }
+
+    bool deserializeStringStatus(SerializedPayload_t& payload, StringStatusTelemetry& data)
+    {
+        FastBuffer buffer(reinterpret_cast<char*>(payload.data), payload.length);
+        Cdr deser(buffer, Cdr::DEFAULT_ENDIAN);
+
+        try
+        {
+            deser.read_encapsulation();
+            deser.deserialize_type(EncodingAlgorithmFlag::DELIMIT_CDR2,
+                [&data](Cdr& dcdr, const MemberId& mid) -> bool
+                {
+                    switch (mid.id)
+                    {
+                        case 0: dcdr >> data.id; break;
+                        case 1: dcdr >> data.x; break;
+                        case 2: dcdr >> data.y; break;
+                        case 3: dcdr >> data.orientation; break;
+                        case 4: dcdr >> data.battery_level; break;
+                        case 5: dcdr >> data.speed; break;
+                        case 6: dcdr >> data.status; break;
+                        case 7: dcdr >> data.timestamp; break;
+                        default: return false;
+                    }
+                    return true;
+                });
+        }
+        catch (exception::Exception&)
+        {
+            return false;
+        }
+        return true;
+    }
+
+    double nsPerSample(std::chrono::steady_clock::time_point start, int samples)
+    {
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / samples;
+    }
+
+    RobotSimulator createSimulator()
+    {
+        RobotSimulator simulator("robo003");
+        simulator.setCircularMotion(5.0, 0.2);
+        // drains to LOW_BATTERY and charges back during the run, so all statuses show up
+        simulator.setBatteryDrainRate(5.0f);
+        simulator.setBatteryChargeRate(20.0f);
+        return simulator;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int samples = argc > 1 ? std::atoi(argv[1]) : 1000000;
+
+    RobotTelemetryPubSubType type;
+    SerializedPayload_t payload(type.max_serialized_type_size + kStringStatusMaxCdrSize);
+
+    std::cout << "=== Status field benchmark (" << samples << " samples) ===" << std::endl;
+    std::cout << "Max CDR size, string status: " << kStringStatusMaxCdrSize << " bytes" << std::endl;
+    std::cout << "Max CDR size, enum status:   " << RobotTelemetry_max_cdr_typesize << " bytes"
+              << " (max_serialized_type_size " << type.max_serialized_type_size << ")" << std::endl;
+
+    // string status
+    RobotSimulator string_simulator = createSimulator();
+    RobotTelemetry sample;
+    StringStatusTelemetry string_received;
+    uint64_t string_bytes = 0;
+    int string_low = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < samples; i++)
+    {
+        string_simulator.update(0.1);
+        string_simulator.fillTelemetry(sample);
+        // what determineStatus() used to return every tick
+        std::string status = RobotModels::statusName(sample.status());
+
+        serializeStringStatus(sample, status, payload);
+        string_bytes += payload.length;
+        deserializeStringStatus(payload, string_received);
+        if (string_received.status == "LOW_BATTERY")
+            string_low++;
+    }
+    double string_ns = nsPerSample(start, samples);
+
+    // enum status
+    RobotSimulator enum_simulator = createSimulator();
+    RobotTelemetry enum_received;
+    uint64_t enum_bytes = 0;
+    int enum_low = 0;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < samples; i++)
+    {
+        enum_simulator.update(0.1);
+        enum_simulator.fillTelemetry(sample);
+
+        type.serialize(&sample, payload, eprosima::fastdds::dds::XCDR2_DATA_REPRESENTATION);
+        enum_bytes += payload.length;
+        type.deserialize(payload, &enum_received);
+        if (enum_received.status() == RobotStatus::LOW_BATTERY)
+            enum_low++;
+    }
+    double enum_ns = nsPerSample(start, samples);
+
+    std::cout << std::fixed << std::setprecision(1) << std::endl;
+    std::cout << "string status: " << std::setw(7) << string_ns << " ns/sample | "
+              << static_cast<double>(string_bytes) / samples << " bytes/sample | LOW_BATTERY: " << string_low << std::endl;
+    std::cout << "enum status:   " << std::setw(7) << enum_ns << " ns/sample | "
+              << static_cast<double>(enum_bytes) / samples << " bytes/sample | LOW_BATTERY: " << enum_low << std::endl;
+    std::cout << "CPU: " << std::setprecision(2) << string_ns / enum_ns << "x" << std::endl;
+
+    return string_low == enum_low ? 0 : 1;
+}
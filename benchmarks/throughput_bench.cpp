@@ -0,0 +1,504 @@
+// Throughput saturation benchmark: ramps the send rate until the stack gives up
+//
+// usage: throughput_bench [--profiles A,B,...] [--start-rate N] [--max-rate N]
+//                         [--step-seconds N] [--tick-hz N] [--max-loss PCT]
+//                         [--max-latency-ms N] [--udp]
+//
+// The subscriber runs in a child process (this binary, re-executed), so each
+// side's CPU time is its own process's and samples take the real transport.
+// The publisher writes `robots` samples per tick, one per robot (distinct
+// keys), at `tick-hz`: the robots per tick grow with the target rate up to
+// kMaxRobotsPerTick (1024), then the tick rate grows. Every step runs for
+// --step-seconds and the target rate doubles, starting at --start-rate
+// (default 1000 msgs/s). The `timestamp` field carries CLOCK_MONOTONIC ns
+// (shared by both processes), the child keeps a LatencyHistogram of it.
+//
+// A step fails when the loss exceeds --max-loss (default 1 %), the one-way
+// p99 exceeds --max-latency-ms (default 10), or the publisher reaches less
+// than 90 % of the target (blocked writes, CPU). The knee is the last step
+// that passed. Per step: msgs/s sent and received, MB/s, loss, latency and
+// CPU % of each side (100 % = one core).
+
+#include "RobotPublisher.hpp"
+#include "RobotSubscriber.hpp"
+#include "RobotSimulator.hpp"
+#include "QoSProfiles.hpp"
+#include "LatencyHistogram.hpp"
+#include "TelemetryConversions.hpp"
+#include "TickScheduler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace
+{
+    // robots published per tick, under the default fleet size's instance limits
+    const std::size_t kMaxRobotsPerTick = 1024;
+
+    struct Options
+    {
+        std::vector<std::string> profiles;   // empty = all
+        double start_rate = 1000.0;
+        double max_rate = 4000000.0;
+        double step_seconds = 2.0;
+        double tick_hz = 100.0;
+        double max_loss_percent = 1.0;
+        double max_latency_ms = 10.0;
+        bool udp = false;
+    };
+
+    struct Profile
+    {
+        std::string name;
+        DataWriterQos writer_qos;
+        DataReaderQos reader_qos;
+        bool plain;
+    };
+
+    // subscriber process -> publisher process, one per report request
+    struct SideReport
+    {
+        uint64_t received;
+        int64_t cpu_ns;
+        double p50_us;
+        double p99_us;
+        double max_us;
+    };
+
+    struct Step
+    {
+        double target_rate;
+        std::size_t robots;
+        double sent_rate;
+        double received_rate;
+        double mb_per_s;
+        double loss_percent;
+        double p50_us;
+        double p99_us;
+        double publisher_cpu;
+        double subscriber_cpu;
+        bool passed;
+    };
+
+    std::vector<Profile> allProfiles()
+    {
+        return {
+            {"RELIABLE_TRANSIENT", QoSProfiles::getReliableTransientWriterQoS(), QoSProfiles::getReliableTransientReaderQoS(), false},
+            {"BEST_EFFORT", QoSProfiles::getBestEffortWriterQoS(), QoSProfiles::getBestEffortReaderQoS(), false},
+            {"RELIABLE_DEADLINE", QoSProfiles::getReliableWithDeadlineWriterQoS(), QoSProfiles::getReliableWithDeadlineReaderQoS(), false},
+            {"RELIABLE_LIFESPAN", QoSProfiles::getReliableWithLifespanWriterQoS(), QoSProfiles::getReliableWithLifespanReaderQoS(), false},
+            {"RELIABLE_KEEP_ALL", QoSProfiles::getReliableKeepAllWriterQoS(), QoSProfiles::getReliableKeepAllReaderQoS(), false},
+            {"DATA_SHARING", QoSProfiles::getDataSharingWriterQoS(), QoSProfiles::getDataSharingReaderQoS(), true},
+        };
+    }
+
+    bool findProfile(const std::string& name, Profile& profile)
+    {
+        for (const Profile& candidate : allProfiles())
+        {
+            if (candidate.name == name)
+            {
+                profile = candidate;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<std::string> splitList(const std::string& list)
+    {
+        std::vector<std::string> items;
+        std::stringstream stream(list);
+        std::string item;
+        while (std::getline(stream, item, ','))
+        {
+            if (!item.empty())
+                items.push_back(item);
+        }
+        return items;
+    }
+
+    bool parseOptions(int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string arg = argv[i];
+            if (arg == "--profiles" && i + 1 < argc)
+                options.profiles = splitList(argv[++i]);
+            else if (arg == "--start-rate" && i + 1 < argc)
+                options.start_rate = std::max(1.0, std::atof(argv[++i]));
+            else if (arg == "--max-rate" && i + 1 < argc)
+                options.max_rate = std::max(1.0, std::atof(argv[++i]));
+            else if (arg == "--step-seconds" && i + 1 < argc)
+                options.step_seconds = std::max(0.1, std::atof(argv[++i]));
+            else if (arg == "--tick-hz" && i + 1 < argc)
+                options.tick_hz = std::max(1.0, std::atof(argv[++i]));
+            else if (arg == "--max-loss" && i + 1 < argc)
+                options.max_loss_percent = std::max(0.0, std::atof(argv[++i]));
+            else if (arg == "--max-latency-ms" && i + 1 < argc)
+                options.max_latency_ms = std::max(0.0, std::atof(argv[++i]));
+            else if (arg == "--udp")
+                options.udp = true;
+            else
+                return false;
+        }
+        return true;
+    }
+
+    int64_t processCpuNs()
+    {
+        timespec ts;
+        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+        return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+    }
+
+    bool readAll(int fd, void* data, std::size_t size)
+    {
+        char* bytes = static_cast<char*>(data);
+        while (size > 0)
+        {
+            ssize_t n = ::read(fd, bytes, size);
+            if (n <= 0)
+                return false;
+            bytes += n;
+            size -= static_cast<std::size_t>(n);
+        }
+        return true;
+    }
+
+    // ------------------------------------------------------------------
+    // subscriber process
+    // ------------------------------------------------------------------
+
+    // counts samples and their latency until the command pipe closes;
+    // every command byte is answered with a SideReport (histogram reset)
+    int runSubscriberSide(const std::string& profile_name, int command_fd, int report_fd, bool udp)
+    {
+        Profile profile;
+        if (!findProfile(profile_name, profile))
+            return 1;
+
+        // keep the parent's table readable
+        if (std::freopen("/dev/null", "w", stdout) == nullptr)
+            return 1;
+
+        std::atomic<uint64_t> received(0);
+        LatencyHistogram latency;
+
+        RobotSubscriber subscriber;
+        subscriber.setTopicName("throughput");
+        subscriber.setSampleCallback([&](const RobotTelemetry& telemetry, const SampleInfo&)
+        {
+            latency.record(TickScheduler::nowNs() - static_cast<int64_t>(telemetry.timestamp()));
+            received.fetch_add(1, std::memory_order_relaxed);
+        });
+
+        DomainParticipantQos pqos = udp ? QoSProfiles::getUdpOnlyParticipantQoS() : PARTICIPANT_QOS_DEFAULT;
+        bool initialized = profile.plain ? subscriber.initPlain(profile.reader_qos, pqos)
+                                         : subscriber.init(profile.reader_qos, pqos);
+        if (!initialized)
+            return 1;
+
+        char command;
+        while (readAll(command_fd, &command, 1))
+        {
+            LatencyHistogram::Summary summary = latency.summary();
+            latency.reset();
+
+            SideReport report;
+            report.received = received.load(std::memory_order_relaxed);
+            report.cpu_ns = processCpuNs();
+            report.p50_us = summary.p50_us;
+            report.p99_us = summary.p99_us;
+            report.max_us = summary.max_us;
+            if (::write(report_fd, &report, sizeof(report)) != static_cast<ssize_t>(sizeof(report)))
+                break;
+        }
+
+        subscriber.stop();
+        return 0;
+    }
+
+    // ------------------------------------------------------------------
+    // publisher process
+    // ------------------------------------------------------------------
+
+    struct SubscriberProcess
+    {
+        pid_t pid = -1;
+        int command_fd = -1;
+        int report_fd = -1;
+
+        bool start(const std::string& profile, bool udp)
+        {
+            int command_pipe[2];
+            int report_pipe[2];
+            if (::pipe(command_pipe) != 0 || ::pipe(report_pipe) != 0)
+                return false;
+
+            // built before fork(): the parent may already run DDS threads,
+            // so the child only closes and execs (no allocation)
+            std::string command_arg = std::to_string(command_pipe[0]);
+            std::string report_arg = std::to_string(report_pipe[1]);
+            const char* args[] = {"throughput_bench", "--subscriber-side", profile.c_str(),
+                                  command_arg.c_str(), report_arg.c_str(), udp ? "--udp" : nullptr, nullptr};
+
+            pid = ::fork();
+            if (pid < 0)
+                return false;
+
+            if (pid == 0)
+            {
+                ::close(command_pipe[1]);
+                ::close(report_pipe[0]);
+                ::execv("/proc/self/exe", const_cast<char* const*>(args));
+                ::_exit(127);
+            }
+
+            ::close(command_pipe[0]);
+            ::close(report_pipe[1]);
+            command_fd = command_pipe[1];
+            report_fd = report_pipe[0];
+            return true;
+        }
+
+        bool report(SideReport& side)
+        {
+            char command = 'r';
+            return ::write(command_fd, &command, 1) == 1 && readAll(report_fd, &side, sizeof(side));
+        }
+
+        void stop()
+        {
+            if (pid <= 0)
+                return;
+
+            ::close(command_fd);
+            ::close(report_fd);
+            ::waitpid(pid, nullptr, 0);
+            pid = -1;
+        }
+    };
+
+    bool runStep(RobotPublisher& publisher, SubscriberProcess& subscriber, bool plain,
+                 std::vector<RobotTelemetry>& samples, std::vector<RobotTelemetryPlain>& plain_samples,
+                 uint32_t sample_bytes, double target_rate, const Options& options, Step& step)
+    {
+        // robots per tick first, then the tick rate
+        std::size_t robots = static_cast<std::size_t>(std::ceil(target_rate / options.tick_hz));
+        robots = std::min(std::max<std::size_t>(robots, 1), samples.size());
+        double tick_hz = target_rate / robots;
+
+        SideReport before;
+        SideReport after;
+        if (!subscriber.report(before))
+            return false;
+
+        int64_t cpu_start = processCpuNs();
+        int64_t start = TickScheduler::nowNs();
+        int64_t end = start + static_cast<int64_t>(options.step_seconds * 1e9);
+        uint64_t sent = 0;
+
+        TickScheduler scheduler(tick_hz, TickScheduler::Policy::SKIP);
+        scheduler.start();
+        while (TickScheduler::nowNs() < end)
+        {
+            for (std::size_t i = 0; i < robots; i++)
+            {
+                uint64_t now = static_cast<uint64_t>(TickScheduler::nowNs());
+                bool ok;
+                if (plain)
+                {
+                    plain_samples[i].timestamp(now);
+                    ok = publisher.publish(plain_samples[i]);
+                }
+                else
+                {
+                    samples[i].timestamp(now);
+                    ok = publisher.publish(samples[i]);
+                }
+                if (ok)
+                    sent++;
+            }
+            scheduler.wait();
+        }
+        double send_seconds = (TickScheduler::nowNs() - start) / 1e9;
+        int64_t publisher_cpu = processCpuNs() - cpu_start;
+
+        // samples still in flight belong to this step
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        double seconds = (TickScheduler::nowNs() - start) / 1e9;
+        if (!subscriber.report(after))
+            return false;
+
+        uint64_t received = after.received - before.received;
+
+        step.target_rate = target_rate;
+        step.robots = robots;
+        step.sent_rate = sent / send_seconds;
+        step.received_rate = received / send_seconds;
+        step.mb_per_s = step.received_rate * sample_bytes / 1e6;
+        step.loss_percent = sent > 0 ? 100.0 * (1.0 - std::min<double>(received, sent) / sent) : 0.0;
+        step.p50_us = after.p50_us;
+        step.p99_us = after.p99_us;
+        step.publisher_cpu = 100.0 * publisher_cpu / (send_seconds * 1e9);
+        step.subscriber_cpu = 100.0 * (after.cpu_ns - before.cpu_ns) / (seconds * 1e9);
+        step.passed = step.loss_percent <= options.max_loss_percent &&
+                      step.p99_us <= options.max_latency_ms * 1000.0 &&
+                      step.sent_rate >= 0.9 * target_rate;
+        return true;
+    }
+
+    void printStep(const Step& s)
+    {
+        std::cout << std::fixed << std::setprecision(0)
+                  << "  target " << std::setw(8) << s.target_rate << " msg/s (" << std::setw(4) << s.robots << " robots/tick)"
+                  << " | sent " << std::setw(8) << s.sent_rate
+                  << " | recv " << std::setw(8) << s.received_rate
+                  << std::setprecision(2) << " | " << std::setw(7) << s.mb_per_s << " MB/s"
+                  << " | loss " << std::setw(6) << s.loss_percent << " %"
+                  << std::setprecision(1) << " | p50 " << std::setw(8) << s.p50_us << " us"
+                  << " | p99 " << std::setw(9) << s.p99_us << " us"
+                  << std::setprecision(0) << " | CPU pub " << std::setw(3) << s.publisher_cpu << " %"
+                  << ", sub " << std::setw(3) << s.subscriber_cpu << " %"
+                  << (s.passed ? "" : "  <- FAIL") << std::endl;
+    }
+
+    // returns the knee (last passing step), target_rate 0 if none passed
+    bool runProfile(const Profile& profile, const Options& options, Step& knee)
+    {
+        knee = Step();
+
+        SubscriberProcess subscriber;
+        if (!subscriber.start(profile.name, options.udp))
+        {
+            std::cerr << "[Bench] " << profile.name << ": cannot start the subscriber process" << std::endl;
+            return false;
+        }
+
+        DomainParticipantQos pqos = options.udp ? QoSProfiles::getUdpOnlyParticipantQoS() : PARTICIPANT_QOS_DEFAULT;
+        RobotPublisher publisher;
+        publisher.setTopicName("throughput");
+        bool initialized = profile.plain ? publisher.initPlain(profile.writer_qos, pqos)
+                                         : publisher.init(profile.writer_qos, pqos);
+
+        for (int i = 0; initialized && i < 200 && publisher.getMatchedSubscribers() == 0; i++)
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        if (!initialized || publisher.getMatchedSubscribers() == 0)
+        {
+            std::cerr << "[Bench] " << profile.name << ": setup or matching failed" << std::endl;
+            publisher.stop();
+            subscriber.stop();
+            return false;
+        }
+
+        // one sample per robot (instance), filled once
+        std::vector<RobotTelemetry> samples(kMaxRobotsPerTick);
+        std::vector<RobotTelemetryPlain> plain_samples(kMaxRobotsPerTick);
+        for (std::size_t i = 0; i < samples.size(); i++)
+        {
+            // room for any size_t
+            char id[32];
+            std::snprintf(id, sizeof(id), "robot%04zu", i);
+            RobotSimulator simulator(id);
+            simulator.fillTelemetry(samples[i]);
+            TelemetryConversions::toPlain(samples[i], plain_samples[i]);
+        }
+        uint32_t sample_bytes = profile.plain
+            ? RobotTelemetryPlainPubSubType().calculate_serialized_size(&plain_samples[0], XCDR2_DATA_REPRESENTATION)
+            : RobotTelemetryPubSubType().calculate_serialized_size(&samples[0], XCDR2_DATA_REPRESENTATION);
+
+        std::cout << "\n--- " << profile.name << " (" << sample_bytes << " B/sample) ---" << std::endl;
+
+        bool ok = true;
+        for (double rate = options.start_rate; rate <= options.max_rate; rate *= 2.0)
+        {
+            Step step;
+            if (!runStep(publisher, subscriber, profile.plain, samples, plain_samples, sample_bytes, rate, options, step))
+            {
+                std::cerr << "[Bench] " << profile.name << ": subscriber process lost" << std::endl;
+                ok = false;
+                break;
+            }
+
+            printStep(step);
+            if (!step.passed)
+                break;
+            knee = step;
+        }
+
+        publisher.stop();
+        subscriber.stop();
+        return ok;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc >= 5 && std::strcmp(argv[1], "--subscriber-side") == 0)
+    {
+        bool udp = argc > 5 && std::strcmp(argv[5], "--udp") == 0;
+        return runSubscriberSide(argv[2], std::atoi(argv[3]), std::atoi(argv[4]), udp);
+    }
+
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        std::cerr << "usage: " << argv[0] << " [--profiles A,B,...] [--start-rate N] [--max-rate N]"
+                  << " [--step-seconds N] [--tick-hz N] [--max-loss PCT] [--max-latency-ms N] [--udp]" << std::endl;
+        return 1;
+    }
+
+    std::cout << "=== Throughput saturation benchmark (" << options.step_seconds << " s per step, fail at "
+              << options.max_loss_percent << " % loss or p99 > " << options.max_latency_ms << " ms, "
+              << (options.udp ? "UDPv4" : "default transports") << ") ===" << std::endl;
+
+    std::vector<std::pair<std::string, Step>> knees;
+    bool ok = true;
+    for (const Profile& profile : allProfiles())
+    {
+        if (!options.profiles.empty() &&
+            std::find(options.profiles.begin(), options.profiles.end(), profile.name) == options.profiles.end())
+            continue;
+
+        Step knee;
+        if (runProfile(profile, options, knee))
+            knees.emplace_back(profile.name, knee);
+        else
+            ok = false;
+    }
+
+    std::cout << "\n=== Knee points ===" << std::endl;
+    for (const auto& entry : knees)
+    {
+        const Step& k = entry.second;
+        std::cout << std::left << std::setw(20) << entry.first << std::right;
+        if (k.target_rate == 0.0)
+        {
+            std::cout << " | no step passed" << std::endl;
+            continue;
+        }
+        std::cout << std::fixed << std::setprecision(0)
+                  << " | " << std::setw(8) << k.received_rate << " msg/s"
+                  << std::setprecision(2) << " | " << std::setw(7) << k.mb_per_s << " MB/s"
+                  << std::setprecision(1) << " | p99 " << std::setw(8) << k.p99_us << " us"
+                  << std::setprecision(0) << " | CPU pub " << k.publisher_cpu << " %, sub " << k.subscriber_cpu << " %"
+                  << std::endl;
+    }
+
+    return ok ? 0 : 1;
+}
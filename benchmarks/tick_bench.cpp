@@ -0,0 +1,102 @@
+// Publish loop timing benchmark: sleep_for after the work vs TickScheduler
+//
+// usage: tick_bench [rate_hz=100] [work_us=2000] [seconds=3] [spin_us=200]
+//
+// Each tick burns `work_us` of CPU (simulator update + serialization +
+// write). The sleep_for loop sleeps a full period after the work, like the
+// old publisher_main loop; TickScheduler waits for absolute deadlines, with
+// and without a busy-wait tail. Achieved rate and wake-up jitter are shown.
+// A last case makes every 10th tick overrun three periods, for the policies.
+
+#include "TickScheduler.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    void burn(int64_t us)
+    {
+        int64_t until = TickScheduler::nowNs() + us * 1000;
+        while (TickScheduler::nowNs() < until)
+        {
+        }
+    }
+
+    void printRow(const char* name, uint64_t ticks, double seconds, double rate_hz, const TickScheduler::Stats* stats)
+    {
+        std::cout << std::left << std::setw(26) << name << std::right << std::fixed
+                  << " | " << std::setprecision(2) << std::setw(8) << ticks / seconds << " Hz"
+                  << " (" << std::setprecision(1) << std::setw(5) << 100.0 * ticks / (seconds * rate_hz) << " %)";
+        if (stats != nullptr)
+        {
+            std::cout << " | jitter mean: " << std::setw(7) << stats->mean_jitter_us << " us"
+                      << ", p99: < " << std::setw(6) << stats->p99_jitter_us << " us"
+                      << ", max: " << std::setw(8) << stats->max_jitter_us << " us"
+                      << " | overruns: " << stats->overruns << ", skipped: " << stats->skipped;
+        }
+        std::cout << std::endl;
+    }
+
+    void runScheduler(const char* name, double rate_hz, int64_t work_us, int seconds,
+                      TickScheduler::Policy policy, int64_t spin_us, bool overrun)
+    {
+        TickScheduler scheduler(rate_hz, policy, spin_us * 1000);
+        int64_t period_us = scheduler.getPeriodNs() / 1000;
+        uint64_t periods = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        auto end = start + std::chrono::seconds(seconds);
+        scheduler.start();
+        for (uint64_t tick = 0; std::chrono::steady_clock::now() < end; tick++)
+        {
+            burn(overrun && tick % 10 == 9 ? 3 * period_us : work_us);
+            periods += scheduler.wait();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        TickScheduler::Stats stats = scheduler.getStats();
+        printRow(name, stats.ticks, elapsed.count(), rate_hz, &stats);
+        if (overrun)
+            std::cout << std::setw(26) << "" << " | periods advanced: " << periods
+                      << " (expected ~" << static_cast<uint64_t>(elapsed.count() * rate_hz) << ")" << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    double rate_hz = argc > 1 ? std::atof(argv[1]) : 100.0;
+    int64_t work_us = argc > 2 ? std::atoll(argv[2]) : 2000;
+    int seconds = argc > 3 ? std::atoi(argv[3]) : 3;
+    int64_t spin_us = argc > 4 ? std::atoll(argv[4]) : 200;
+
+    std::cout << "=== Tick scheduling benchmark (" << rate_hz << " Hz, " << work_us << " us work, "
+              << seconds << " s per case) ===" << std::endl;
+
+    // old loop: work, then sleep a whole period
+    {
+        auto period = std::chrono::nanoseconds(static_cast<int64_t>(1e9 / rate_hz));
+        uint64_t ticks = 0;
+        auto start = std::chrono::steady_clock::now();
+        auto end = start + std::chrono::seconds(seconds);
+        while (std::chrono::steady_clock::now() < end)
+        {
+            burn(work_us);
+            std::this_thread::sleep_for(period);
+            ticks++;
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        printRow("sleep_for(period)", ticks, elapsed.count(), rate_hz, nullptr);
+    }
+
+    runScheduler("TickScheduler", rate_hz, work_us, seconds, TickScheduler::Policy::SKIP, 0, false);
+    runScheduler("TickScheduler + spin", rate_hz, work_us, seconds, TickScheduler::Policy::SKIP, spin_us, false);
+    runScheduler("overruns, CATCH_UP", rate_hz, work_us, seconds, TickScheduler::Policy::CATCH_UP, 0, true);
+    runScheduler("overruns, SKIP", rate_hz, work_us, seconds, TickScheduler::Policy::SKIP, 0, true);
+
+    return 0;
+}
@@ -0,0 +1,278 @@
+// Writer fan-out benchmark: one keyed DataWriter vs K writers vs one writer per robot
+//
+// usage: writer_fanout_bench [--robots N] [--ticks N] [--writers 1,4,16,64,256]
+//
+// For each writer count K of --writers (clamped to --robots, default 256) a
+// RobotPublisher spreads the fleet over K DataWriters (setWriterCount), K =
+// robots being one writer and one history per robot. A subscriber with the
+// RELIABLE KEEP_ALL profile is up first, in the same process (intraprocess
+// delivery off, UDPv4 only), so each run reports:
+//   - setup:     create_participant .. the K writers created
+//   - discovery: setup start .. every writer matched and the reader matched K
+//   - memory:    process RSS growth after discovery and after the traffic
+//                (writer histories, proxies on both sides), total and per writer
+//   - traffic:   --ticks (default 100) ticks of every robot, written as fast
+//                as the writers take them; samples/s delivered and the
+//                publisher thread's CPU time per sample
+// Every run starts from a fresh participant pair.
+
+#include "RobotPublisher.hpp"
+#include "RobotSubscriber.hpp"
+#include "FleetSimulator.hpp"
+#include "BenchFleet.hpp"
+#include "QoSProfiles.hpp"
+#include <fastdds/LibrarySettings.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <time.h>
+#include <unistd.h>
+
+namespace
+{
+    struct Options
+    {
+        std::size_t robots = 256;
+        int ticks = 100;
+        std::vector<std::size_t> writers = {1, 4, 16, 64, 256};
+    };
+
+    struct Result
+    {
+        std::size_t writers;
+        double setup_ms;
+        double discovery_ms;
+        double rss_setup_kb;
+        double rss_traffic_kb;
+        uint64_t delivered;
+        double samples_per_s;
+        double publish_ns;      // per sample, publisher thread CPU
+    };
+
+    std::vector<std::string> splitList(const std::string& list)
+    {
+        std::vector<std::string> items;
+        std::stringstream stream(list);
+        std::string item;
+        while (std::getline(stream, item, ','))
+        {
+            if (!item.empty())
+                items.push_back(item);
+        }
+        return items;
+    }
+
+    bool parseOptions(int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string arg = argv[i];
+            if (arg == "--robots" && i + 1 < argc)
+                options.robots = std::max<std::size_t>(1, std::strtoull(argv[++i], nullptr, 10));
+            else if (arg == "--ticks" && i + 1 < argc)
+                options.ticks = std::max(1, std::atoi(argv[++i]));
+            else if (arg == "--writers" && i + 1 < argc)
+            {
+                options.writers.clear();
+                for (const std::string& count : splitList(argv[++i]))
+                    options.writers.push_back(std::max<std::size_t>(1, std::strtoull(count.c_str(), nullptr, 10)));
+            }
+            else
+                return false;
+        }
+        return !options.writers.empty();
+    }
+
+    int64_t threadCpuNs()
+    {
+        timespec ts;
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+        return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+    }
+
+    double msSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // resident set size from /proc/self/statm, 0 if unavailable
+    double residentKb()
+    {
+        std::ifstream in("/proc/self/statm");
+        uint64_t size = 0;
+        uint64_t resident = 0;
+        if (!(in >> size >> resident))
+            return 0.0;
+        return static_cast<double>(resident) * ::sysconf(_SC_PAGESIZE) / 1024.0;
+    }
+
+    bool runWriters(std::size_t writers, const Options& options, Result& result)
+    {
+        DomainParticipantQos pqos = QoSProfiles::getUdpOnlyParticipantQoS();
+
+        FleetSimulator fleet;
+        BenchFleet::buildFleet(fleet, options.robots);
+
+        std::atomic<uint64_t> delivered(0);
+        RobotSubscriber subscriber;
+        subscriber.setTopicName("writer_fanout");
+        subscriber.setSampleCallback([&delivered](const RobotTelemetry&, const SampleInfo&)
+        {
+            delivered.fetch_add(1, std::memory_order_relaxed);
+        });
+        if (!subscriber.init(QoSProfiles::getReliableKeepAllReaderQoS(), pqos))
+        {
+            std::cerr << "[Bench] subscriber setup failed" << std::endl;
+            return false;
+        }
+
+        double rss_start = residentKb();
+        auto setup_start = std::chrono::steady_clock::now();
+
+        RobotPublisher publisher;
+        publisher.setTopicName("writer_fanout");
+        publisher.setWriterCount(writers);
+        if (!publisher.init(QoSProfiles::getReliableKeepAllWriterQoS(), pqos))
+        {
+            std::cerr << "[Bench] publisher setup failed with " << writers << " writers" << std::endl;
+            return false;
+        }
+        result.setup_ms = msSince(setup_start);
+
+        // 30 s for every writer to match the reader both ways
+        bool matched = false;
+        for (int i = 0; i < 3000 && !matched; i++)
+        {
+            matched = publisher.getMatchedWriters() == writers &&
+                      subscriber.getMatchedPublishers() == static_cast<int>(writers);
+            if (!matched)
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        if (!matched)
+        {
+            std::cerr << "[Bench] " << publisher.getMatchedWriters() << " of " << writers
+                      << " writers matched after 30 s" << std::endl;
+            return false;
+        }
+        result.discovery_ms = msSince(setup_start);
+        result.rss_setup_kb = residentKb() - rss_start;
+
+        const double dt = 0.1;
+        const uint64_t expected = options.robots * static_cast<uint64_t>(options.ticks);
+        int64_t publish_ns = 0;
+        auto traffic_start = std::chrono::steady_clock::now();
+
+        for (int tick = 0; tick < options.ticks; tick++)
+        {
+            fleet.update(dt);
+
+            int64_t start = threadCpuNs();
+            for (std::size_t i = 0; i < options.robots; i++)
+                publisher.publishLoaned([&fleet, i](RobotTelemetry& sample) { fleet.fillTelemetry(i, sample); });
+            publish_ns += threadCpuNs() - start;
+        }
+
+        // until everything is delivered, or 10 s without progress
+        uint64_t seen = 0;
+        auto last_delivery = std::chrono::steady_clock::now();
+        for (int idle = 0; idle < 1000 && delivered.load() < expected; idle++)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            if (delivered.load() != seen)
+            {
+                seen = delivered.load();
+                last_delivery = std::chrono::steady_clock::now();
+                idle = 0;
+            }
+        }
+        if (delivered.load() >= expected)
+            last_delivery = std::chrono::steady_clock::now();
+
+        double traffic_s = std::chrono::duration<double>(last_delivery - traffic_start).count();
+        result.rss_traffic_kb = residentKb() - rss_start;
+
+        publisher.stop();
+        subscriber.stop();
+
+        result.writers = writers;
+        result.delivered = delivered.load();
+        result.samples_per_s = traffic_s > 0.0 ? result.delivered / traffic_s : 0.0;
+        result.publish_ns = static_cast<double>(publish_ns) / expected;
+        return true;
+    }
+
+    void printResult(const Result& r, uint64_t expected)
+    {
+        std::cout << std::fixed << std::setprecision(1)
+                  << std::setw(8) << r.writers
+                  << std::setw(11) << r.setup_ms
+                  << std::setw(11) << r.discovery_ms
+                  << std::setw(12) << r.rss_setup_kb
+                  << std::setw(12) << r.rss_traffic_kb
+                  << std::setw(11) << r.rss_traffic_kb / r.writers
+                  << std::setw(11) << r.delivered << "/" << expected
+                  << std::setprecision(0) << std::setw(12) << r.samples_per_s
+                  << std::setw(10) << r.publish_ns << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        std::cerr << "usage: " << argv[0] << " [--robots N] [--ticks N] [--writers 1,4,16,64,256]" << std::endl;
+        return 1;
+    }
+
+    // every profile below keeps one instance per robot (default cap: 1024)
+    QoSProfiles::setFleetSize(static_cast<int32_t>(std::min<std::size_t>(options.robots, INT32_MAX)));
+
+    // in-process delivery would skip the transport
+    eprosima::fastdds::LibrarySettings settings;
+    settings.intraprocess_delivery = eprosima::fastdds::INTRAPROCESS_OFF;
+    DomainParticipantFactory::get_instance()->set_library_settings(settings);
+
+    std::cout << "=== Writer fan-out benchmark ===" << std::endl;
+    std::cout << "Robots: " << options.robots << " | Ticks: " << options.ticks
+              << " | UDPv4 loopback, RELIABLE KEEP_ALL" << std::endl;
+
+    const uint64_t expected = options.robots * static_cast<uint64_t>(options.ticks);
+    std::vector<Result> results;
+    bool ok = true;
+    for (std::size_t writers : options.writers)
+    {
+        // more writers than robots would leave some without a sample
+        writers = std::min(writers, options.robots);
+        std::cout << "[Bench] " << writers << " writer(s)..." << std::endl;
+
+        Result result;
+        if (!runWriters(writers, options, result))
+        {
+            ok = false;
+            continue;
+        }
+        if (result.delivered != expected)
+            ok = false;
+        results.push_back(result);
+    }
+
+    // setup / discovery in ms, RSS growth in KB, throughput in samples/s, CPU in ns per sample
+    std::cout << "\n" << std::setw(8) << "writers" << std::setw(11) << "setup"
+              << std::setw(11) << "discovery" << std::setw(12) << "RSS setup" << std::setw(12) << "RSS total"
+              << std::setw(11) << "KB/writer" << std::setw(17) << "delivered"
+              << std::setw(12) << "samples/s" << std::setw(10) << "pub ns" << std::endl;
+    for (const Result& result : results)
+        printResult(result, expected);
+
+    return ok ? 0 : 1;
+}
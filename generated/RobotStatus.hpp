@@ -0,0 +1,66 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file RobotStatus.hpp
+ * This header file contains the declaration of the described types in the IDL file.
+ *
+ * This file was generated by the tool fastddsgen (version: 4.2.0).
+ */
+
+#ifndef FAST_DDS_GENERATED__ROBOTSTATUS_HPP
+#define FAST_DDS_GENERATED__ROBOTSTATUS_HPP
+
+#include <cstdint>
+
+#if defined(_WIN32)
+#if defined(EPROSIMA_USER_DLL_EXPORT)
+#define eProsima_user_DllExport __declspec( dllexport )
+#else
+#define eProsima_user_DllExport
+#endif  // EPROSIMA_USER_DLL_EXPORT
+#else
+#define eProsima_user_DllExport
+#endif  // _WIN32
+
+#if defined(_WIN32)
+#if defined(EPROSIMA_USER_DLL_EXPORT)
+#if defined(ROBOTSTATUS_SOURCE)
+#define ROBOTSTATUS_DllAPI __declspec( dllexport )
+#else
+#define ROBOTSTATUS_DllAPI __declspec( dllimport )
+#endif // ROBOTSTATUS_SOURCE
+#else
+#define ROBOTSTATUS_DllAPI
+#endif  // EPROSIMA_USER_DLL_EXPORT
+#else
+#define ROBOTSTATUS_DllAPI
+#endif // _WIN32
+
+/*!
+ * @brief This class represents the enumeration RobotStatus defined by the user in the IDL file.
+ * @ingroup RobotStatus
+ */
+enum class RobotStatus : int32_t
+{
+    UNKNOWN,
+    IDLE,
+    MOVING,
+    CHARGING,
+    LOW_BATTERY,
+    DISCHARGED
+};
+
+#endif // _FAST_DDS_GENERATED_ROBOTSTATUS_HPP_
+
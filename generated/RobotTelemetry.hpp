@@ -26,6 +26,7 @@
 #include <string>
 #include <utility>
 #include <fastcdr/cdr/fixed_size_string.hpp>
+#include "RobotStatus.hpp"
 
 #if defined(_WIN32)
 #if defined(EPROSIMA_USER_DLL_EXPORT)
@@ -111,7 +112,7 @@ public:
         m_orientation = x.m_orientation;
         m_battery_level = x.m_battery_level;
         m_speed = x.m_speed;
-        m_status = std::move(x.m_status);
+        m_status = x.m_status;
         m_timestamp = x.m_timestamp;
     }
 
@@ -156,7 +157,7 @@ public:
         m_orientation = x.m_orientation;
         m_battery_level = x.m_battery_level;
         m_speed = x.m_speed;
-        m_status = std::move(x.m_status);
+        m_status = x.m_status;
         m_timestamp = x.m_timestamp;
         return *this;
     }
@@ -373,30 +374,20 @@ public:
 
 
     /*!
-     * @brief This function copies the value in member status
-     * @param _status New value to be copied in member status
+     * @brief This function sets a value in member status
+     * @param _status New value for member status
      */
     eProsima_user_DllExport void status(
-            const std::string& _status)
+            RobotStatus _status)
     {
         m_status = _status;
     }
 
     /*!
-     * @brief This function moves the value in member status
-     * @param _status New value to be moved in member status
+     * @brief This function returns the value of member status
+     * @return Value of member status
      */
-    eProsima_user_DllExport void status(
-            std::string&& _status)
-    {
-        m_status = std::move(_status);
-    }
-
-    /*!
-     * @brief This function returns a constant reference to member status
-     * @return Constant reference to member status
-     */
-    eProsima_user_DllExport const std::string& status() const
+    eProsima_user_DllExport RobotStatus status() const
     {
         return m_status;
     }
@@ -405,7 +396,7 @@ public:
      * @brief This function returns a reference to member status
      * @return Reference to member status
      */
-    eProsima_user_DllExport std::string& status()
+    eProsima_user_DllExport RobotStatus& status()
     {
         return m_status;
     }
@@ -449,7 +440,7 @@ private:
     double m_orientation{0.0};
     float m_battery_level{0.0};
     double m_speed{0.0};
-    std::string m_status;
+    RobotStatus m_status{RobotStatus::UNKNOWN};
     uint64_t m_timestamp{0};
 
 };
@@ -0,0 +1,191 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file RobotTelemetryBatch.hpp
+ * This header file contains the declaration of the described types in the IDL file.
+ *
+ * This file was generated by the tool fastddsgen (version: 4.2.0).
+ */
+
+#ifndef FAST_DDS_GENERATED__ROBOTTELEMETRYBATCH_HPP
+#define FAST_DDS_GENERATED__ROBOTTELEMETRYBATCH_HPP
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "RobotTelemetry.hpp"
+
+#if defined(_WIN32)
+#if defined(EPROSIMA_USER_DLL_EXPORT)
+#define eProsima_user_DllExport __declspec( dllexport )
+#else
+#define eProsima_user_DllExport
+#endif  // EPROSIMA_USER_DLL_EXPORT
+#else
+#define eProsima_user_DllExport
+#endif  // _WIN32
+
+#if defined(_WIN32)
+#if defined(EPROSIMA_USER_DLL_EXPORT)
+#if defined(ROBOTTELEMETRYBATCH_SOURCE)
+#define ROBOTTELEMETRYBATCH_DllAPI __declspec( dllexport )
+#else
+#define ROBOTTELEMETRYBATCH_DllAPI __declspec( dllimport )
+#endif // ROBOTTELEMETRYBATCH_SOURCE
+#else
+#define ROBOTTELEMETRYBATCH_DllAPI
+#endif  // EPROSIMA_USER_DLL_EXPORT
+#else
+#define ROBOTTELEMETRYBATCH_DllAPI
+#endif // _WIN32
+
+/*!
+ * @brief This class represents the structure RobotTelemetryBatch defined by the user in the IDL file.
+ * @ingroup RobotTelemetryBatch
+ */
+class RobotTelemetryBatch
+{
+public:
+
+    /*!
+     * @brief Default constructor.
+     */
+    eProsima_user_DllExport RobotTelemetryBatch()
+    {
+    }
+
+    /*!
+     * @brief Default destructor.
+     */
+    eProsima_user_DllExport ~RobotTelemetryBatch()
+    {
+    }
+
+    /*!
+     * @brief Copy constructor.
+     * @param x Reference to the object RobotTelemetryBatch that will be copied.
+     */
+    eProsima_user_DllExport RobotTelemetryBatch(
+            const RobotTelemetryBatch& x)
+    {
+                    m_samples = x.m_samples;
+
+    }
+
+    /*!
+     * @brief Move constructor.
+     * @param x Reference to the object RobotTelemetryBatch that will be copied.
+     */
+    eProsima_user_DllExport RobotTelemetryBatch(
+            RobotTelemetryBatch&& x) noexcept
+    {
+        m_samples = std::move(x.m_samples);
+    }
+
+    /*!
+     * @brief Copy assignment.
+     * @param x Reference to the object RobotTelemetryBatch that will be copied.
+     */
+    eProsima_user_DllExport RobotTelemetryBatch& operator =(
+            const RobotTelemetryBatch& x)
+    {
+
+                    m_samples = x.m_samples;
+
+        return *this;
+    }
+
+    /*!
+     * @brief Move assignment.
+     * @param x Reference to the object RobotTelemetryBatch that will be copied.
+     */
+    eProsima_user_DllExport RobotTelemetryBatch& operator =(
+            RobotTelemetryBatch&& x) noexcept
+    {
+
+        m_samples = std::move(x.m_samples);
+        return *this;
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x RobotTelemetryBatch object to compare.
+     */
+    eProsima_user_DllExport bool operator ==(
+            const RobotTelemetryBatch& x) const
+    {
+        return (m_samples == x.m_samples);
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x RobotTelemetryBatch object to compare.
+     */
+    eProsima_user_DllExport bool operator !=(
+            const RobotTelemetryBatch& x) const
+    {
+        return !(*this == x);
+    }
+
+    /*!
+     * @brief This function copies the value in member samples
+     * @param _samples New value to be copied in member samples
+     */
+    eProsima_user_DllExport void samples(
+            const std::vector<RobotTelemetry>& _samples)
+    {
+        m_samples = _samples;
+    }
+
+    /*!
+     * @brief This function moves the value in member samples
+     * @param _samples New value to be moved in member samples
+     */
+    eProsima_user_DllExport void samples(
+            std::vector<RobotTelemetry>&& _samples)
+    {
+        m_samples = std::move(_samples);
+    }
+
+    /*!
+     * @brief This function returns a constant reference to member samples
+     * @return Constant reference to member samples
+     */
+    eProsima_user_DllExport const std::vector<RobotTelemetry>& samples() const
+    {
+        return m_samples;
+    }
+
+    /*!
+     * @brief This function returns a reference to member samples
+     * @return Reference to member samples
+     */
+    eProsima_user_DllExport std::vector<RobotTelemetry>& samples()
+    {
+        return m_samples;
+    }
+
+
+
+
+private:
+
+    std::vector<RobotTelemetry> m_samples;
+
+};
+
+#endif // _FAST_DDS_GENERATED_ROBOTTELEMETRYBATCH_HPP_
+
+
@@ -23,8 +23,9 @@
 #define FAST_DDS_GENERATED__ROBOTTELEMETRYCDRAUX_HPP
 
 #include "RobotTelemetry.hpp"
-constexpr uint32_t RobotTelemetry_max_cdr_typesize {576UL};
-constexpr uint32_t RobotTelemetry_max_key_cdr_typesize {0UL};
+#include "RobotStatusCdrAux.hpp"
+constexpr uint32_t RobotTelemetry_max_cdr_typesize {320UL};
+constexpr uint32_t RobotTelemetry_max_key_cdr_typesize {260UL};
 
 
 namespace eprosima {
@@ -166,20 +166,6 @@ void serialize_key(
     static_cast<void>(data);
                         scdr << data.id();
 
-                        scdr << data.x();
-
-                        scdr << data.y();
-
-                        scdr << data.orientation();
-
-                        scdr << data.battery_level();
-
-                        scdr << data.speed();
-
-                        scdr << data.status();
-
-                        scdr << data.timestamp();
-
 }
 
 
@@ -0,0 +1,451 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file RobotTelemetryCompact.hpp
+ * This header file contains the declaration of the described types in the IDL file.
+ *
+ * This file was generated by the tool fastddsgen (version: 4.2.0).
+ */
+
+#ifndef FAST_DDS_GENERATED__ROBOTTELEMETRYCOMPACT_HPP
+#define FAST_DDS_GENERATED__ROBOTTELEMETRYCOMPACT_HPP
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <fastcdr/cdr/fixed_size_string.hpp>
+#include "RobotStatus.hpp"
+
+#if defined(_WIN32)
+#if defined(EPROSIMA_USER_DLL_EXPORT)
+#define eProsima_user_DllExport __declspec( dllexport )
+#else
+#define eProsima_user_DllExport
+#endif  // EPROSIMA_USER_DLL_EXPORT
+#else
+#define eProsima_user_DllExport
+#endif  // _WIN32
+
+#if defined(_WIN32)
+#if defined(EPROSIMA_USER_DLL_EXPORT)
+#if defined(ROBOTTELEMETRYCOMPACT_SOURCE)
+#define ROBOTTELEMETRYCOMPACT_DllAPI __declspec( dllexport )
+#else
+#define ROBOTTELEMETRYCOMPACT_DllAPI __declspec( dllimport )
+#endif // ROBOTTELEMETRYCOMPACT_SOURCE
+#else
+#define ROBOTTELEMETRYCOMPACT_DllAPI
+#endif  // EPROSIMA_USER_DLL_EXPORT
+#else
+#define ROBOTTELEMETRYCOMPACT_DllAPI
+#endif // _WIN32
+
+/*!
+ * @brief This class represents the structure RobotTelemetryCompact defined by the user in the IDL file.
+ * @ingroup RobotTelemetryCompact
+ */
+class RobotTelemetryCompact
+{
+public:
+
+    /*!
+     * @brief Default constructor.
+     */
+    eProsima_user_DllExport RobotTelemetryCompact()
+    {
+    }
+
+    /*!
+     * @brief Default destructor.
+     */
+    eProsima_user_DllExport ~RobotTelemetryCompact()
+    {
+    }
+
+    /*!
+     * @brief Copy constructor.
+     * @param x Reference to the object RobotTelemetryCompact that will be copied.
+     */
+    eProsima_user_DllExport RobotTelemetryCompact(
+            const RobotTelemetryCompact& x)
+    {
+                    m_timestamp = x.m_timestamp;
+
+                    m_id = x.m_id;
+
+                    m_x_mm = x.m_x_mm;
+
+                    m_y_mm = x.m_y_mm;
+
+                    m_status = x.m_status;
+
+                    m_orientation = x.m_orientation;
+
+                    m_speed_mm_s = x.m_speed_mm_s;
+
+                    m_battery_percent = x.m_battery_percent;
+
+    }
+
+    /*!
+     * @brief Move constructor.
+     * @param x Reference to the object RobotTelemetryCompact that will be copied.
+     */
+    eProsima_user_DllExport RobotTelemetryCompact(
+            RobotTelemetryCompact&& x) noexcept
+    {
+        m_timestamp = x.m_timestamp;
+        m_id = std::move(x.m_id);
+        m_x_mm = x.m_x_mm;
+        m_y_mm = x.m_y_mm;
+        m_status = x.m_status;
+        m_orientation = x.m_orientation;
+        m_speed_mm_s = x.m_speed_mm_s;
+        m_battery_percent = x.m_battery_percent;
+    }
+
+    /*!
+     * @brief Copy assignment.
+     * @param x Reference to the object RobotTelemetryCompact that will be copied.
+     */
+    eProsima_user_DllExport RobotTelemetryCompact& operator =(
+            const RobotTelemetryCompact& x)
+    {
+
+                    m_timestamp = x.m_timestamp;
+
+                    m_id = x.m_id;
+
+                    m_x_mm = x.m_x_mm;
+
+                    m_y_mm = x.m_y_mm;
+
+                    m_status = x.m_status;
+
+                    m_orientation = x.m_orientation;
+
+                    m_speed_mm_s = x.m_speed_mm_s;
+
+                    m_battery_percent = x.m_battery_percent;
+
+        return *this;
+    }
+
+    /*!
+     * @brief Move assignment.
+     * @param x Reference to the object RobotTelemetryCompact that will be copied.
+     */
+    eProsima_user_DllExport RobotTelemetryCompact& operator =(
+            RobotTelemetryCompact&& x) noexcept
+    {
+
+        m_timestamp = x.m_timestamp;
+        m_id = std::move(x.m_id);
+        m_x_mm = x.m_x_mm;
+        m_y_mm = x.m_y_mm;
+        m_status = x.m_status;
+        m_orientation = x.m_orientation;
+        m_speed_mm_s = x.m_speed_mm_s;
+        m_battery_percent = x.m_battery_percent;
+        return *this;
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x RobotTelemetryCompact object to compare.
+     */
+    eProsima_user_DllExport bool operator ==(
+            const RobotTelemetryCompact& x) const
+    {
+        return (m_timestamp == x.m_timestamp &&
+           m_id == x.m_id &&
+           m_x_mm == x.m_x_mm &&
+           m_y_mm == x.m_y_mm &&
+           m_status == x.m_status &&
+           m_orientation == x.m_orientation &&
+           m_speed_mm_s == x.m_speed_mm_s &&
+           m_battery_percent == x.m_battery_percent);
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x RobotTelemetryCompact object to compare.
+     */
+    eProsima_user_DllExport bool operator !=(
+            const RobotTelemetryCompact& x) const
+    {
+        return !(*this == x);
+    }
+
+    /*!
+     * @brief This function sets a value in member timestamp
+     * @param _timestamp New value for member timestamp
+     */
+    eProsima_user_DllExport void timestamp(
+            uint64_t _timestamp)
+    {
+        m_timestamp = _timestamp;
+    }
+
+    /*!
+     * @brief This function returns the value of member timestamp
+     * @return Value of member timestamp
+     */
+    eProsima_user_DllExport uint64_t timestamp() const
+    {
+        return m_timestamp;
+    }
+
+    /*!
+     * @brief This function returns a reference to member timestamp
+     * @return Reference to member timestamp
+     */
+    eProsima_user_DllExport uint64_t& timestamp()
+    {
+        return m_timestamp;
+    }
+
+
+    /*!
+     * @brief This function copies the value in member id
+     * @param _id New value to be copied in member id
+     */
+    eProsima_user_DllExport void id(
+            const std::string& _id)
+    {
+        m_id = _id;
+    }
+
+    /*!
+     * @brief This function moves the value in member id
+     * @param _id New value to be moved in member id
+     */
+    eProsima_user_DllExport void id(
+            std::string&& _id)
+    {
+        m_id = std::move(_id);
+    }
+
+    /*!
+     * @brief This function returns a constant reference to member id
+     * @return Constant reference to member id
+     */
+    eProsima_user_DllExport const std::string& id() const
+    {
+        return m_id;
+    }
+
+    /*!
+     * @brief This function returns a reference to member id
+     * @return Reference to member id
+     */
+    eProsima_user_DllExport std::string& id()
+    {
+        return m_id;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member x_mm
+     * @param _x_mm New value for member x_mm
+     */
+    eProsima_user_DllExport void x_mm(
+            int32_t _x_mm)
+    {
+        m_x_mm = _x_mm;
+    }
+
+    /*!
+     * @brief This function returns the value of member x_mm
+     * @return Value of member x_mm
+     */
+    eProsima_user_DllExport int32_t x_mm() const
+    {
+        return m_x_mm;
+    }
+
+    /*!
+     * @brief This function returns a reference to member x_mm
+     * @return Reference to member x_mm
+     */
+    eProsima_user_DllExport int32_t& x_mm()
+    {
+        return m_x_mm;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member y_mm
+     * @param _y_mm New value for member y_mm
+     */
+    eProsima_user_DllExport void y_mm(
+            int32_t _y_mm)
+    {
+        m_y_mm = _y_mm;
+    }
+
+    /*!
+     * @brief This function returns the value of member y_mm
+     * @return Value of member y_mm
+     */
+    eProsima_user_DllExport int32_t y_mm() const
+    {
+        return m_y_mm;
+    }
+
+    /*!
+     * @brief This function returns a reference to member y_mm
+     * @return Reference to member y_mm
+     */
+    eProsima_user_DllExport int32_t& y_mm()
+    {
+        return m_y_mm;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member status
+     * @param _status New value for member status
+     */
+    eProsima_user_DllExport void status(
+            RobotStatus _status)
+    {
+        m_status = _status;
+    }
+
+    /*!
+     * @brief This function returns the value of member status
+     * @return Value of member status
+     */
+    eProsima_user_DllExport RobotStatus status() const
+    {
+        return m_status;
+    }
+
+    /*!
+     * @brief This function returns a reference to member status
+     * @return Reference to member status
+     */
+    eProsima_user_DllExport RobotStatus& status()
+    {
+        return m_status;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member orientation
+     * @param _orientation New value for member orientation
+     */
+    eProsima_user_DllExport void orientation(
+            uint16_t _orientation)
+    {
+        m_orientation = _orientation;
+    }
+
+    /*!
+     * @brief This function returns the value of member orientation
+     * @return Value of member orientation
+     */
+    eProsima_user_DllExport uint16_t orientation() const
+    {
+        return m_orientation;
+    }
+
+    /*!
+     * @brief This function returns a reference to member orientation
+     * @return Reference to member orientation
+     */
+    eProsima_user_DllExport uint16_t& orientation()
+    {
+        return m_orientation;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member speed_mm_s
+     * @param _speed_mm_s New value for member speed_mm_s
+     */
+    eProsima_user_DllExport void speed_mm_s(
+            int16_t _speed_mm_s)
+    {
+        m_speed_mm_s = _speed_mm_s;
+    }
+
+    /*!
+     * @brief This function returns the value of member speed_mm_s
+     * @return Value of member speed_mm_s
+     */
+    eProsima_user_DllExport int16_t speed_mm_s() const
+    {
+        return m_speed_mm_s;
+    }
+
+    /*!
+     * @brief This function returns a reference to member speed_mm_s
+     * @return Reference to member speed_mm_s
+     */
+    eProsima_user_DllExport int16_t& speed_mm_s()
+    {
+        return m_speed_mm_s;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member battery_percent
+     * @param _battery_percent New value for member battery_percent
+     */
+    eProsima_user_DllExport void battery_percent(
+            uint8_t _battery_percent)
+    {
+        m_battery_percent = _battery_percent;
+    }
+
+    /*!
+     * @brief This function returns the value of member battery_percent
+     * @return Value of member battery_percent
+     */
+    eProsima_user_DllExport uint8_t battery_percent() const
+    {
+        return m_battery_percent;
+    }
+
+    /*!
+     * @brief This function returns a reference to member battery_percent
+     * @return Reference to member battery_percent
+     */
+    eProsima_user_DllExport uint8_t& battery_percent()
+    {
+        return m_battery_percent;
+    }
+
+
+
+
+private:
+
+    uint64_t m_timestamp{0};
+    std::string m_id;
+    int32_t m_x_mm{0};
+    int32_t m_y_mm{0};
+    RobotStatus m_status{RobotStatus::UNKNOWN};
+    uint16_t m_orientation{0};
+    int16_t m_speed_mm_s{0};
+    uint8_t m_battery_percent{0};
+
+};
+
+#endif // _FAST_DDS_GENERATED_ROBOTTELEMETRYCOMPACT_HPP_
+
+
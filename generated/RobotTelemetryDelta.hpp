@@ -0,0 +1,239 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file RobotTelemetryDelta.hpp
+ * This header file contains the declaration of the described types in the IDL file.
+ *
+ * This file was generated by the tool fastddsgen (version: 4.2.0).
+ */
+
+#ifndef FAST_DDS_GENERATED__ROBOTTELEMETRYDELTA_HPP
+#define FAST_DDS_GENERATED__ROBOTTELEMETRYDELTA_HPP
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include <fastcdr/cdr/fixed_size_string.hpp>
+
+#if defined(_WIN32)
+#if defined(EPROSIMA_USER_DLL_EXPORT)
+#define eProsima_user_DllExport __declspec( dllexport )
+#else
+#define eProsima_user_DllExport
+#endif  // EPROSIMA_USER_DLL_EXPORT
+#else
+#define eProsima_user_DllExport
+#endif  // _WIN32
+
+#if defined(_WIN32)
+#if defined(EPROSIMA_USER_DLL_EXPORT)
+#if defined(ROBOTTELEMETRYDELTA_SOURCE)
+#define ROBOTTELEMETRYDELTA_DllAPI __declspec( dllexport )
+#else
+#define ROBOTTELEMETRYDELTA_DllAPI __declspec( dllimport )
+#endif // ROBOTTELEMETRYDELTA_SOURCE
+#else
+#define ROBOTTELEMETRYDELTA_DllAPI
+#endif  // EPROSIMA_USER_DLL_EXPORT
+#else
+#define ROBOTTELEMETRYDELTA_DllAPI
+#endif // _WIN32
+
+/*!
+ * @brief This class represents the structure RobotTelemetryDelta defined by the user in the IDL file.
+ * @ingroup RobotTelemetryDelta
+ */
+class RobotTelemetryDelta
+{
+public:
+
+    /*!
+     * @brief Default constructor.
+     */
+    eProsima_user_DllExport RobotTelemetryDelta()
+    {
+    }
+
+    /*!
+     * @brief Default destructor.
+     */
+    eProsima_user_DllExport ~RobotTelemetryDelta()
+    {
+    }
+
+    /*!
+     * @brief Copy constructor.
+     * @param x Reference to the object RobotTelemetryDelta that will be copied.
+     */
+    eProsima_user_DllExport RobotTelemetryDelta(
+            const RobotTelemetryDelta& x)
+    {
+                    m_id = x.m_id;
+
+                    m_frame = x.m_frame;
+
+    }
+
+    /*!
+     * @brief Move constructor.
+     * @param x Reference to the object RobotTelemetryDelta that will be copied.
+     */
+    eProsima_user_DllExport RobotTelemetryDelta(
+            RobotTelemetryDelta&& x) noexcept
+    {
+        m_id = std::move(x.m_id);
+        m_frame = std::move(x.m_frame);
+    }
+
+    /*!
+     * @brief Copy assignment.
+     * @param x Reference to the object RobotTelemetryDelta that will be copied.
+     */
+    eProsima_user_DllExport RobotTelemetryDelta& operator =(
+            const RobotTelemetryDelta& x)
+    {
+
+                    m_id = x.m_id;
+
+                    m_frame = x.m_frame;
+
+        return *this;
+    }
+
+    /*!
+     * @brief Move assignment.
+     * @param x Reference to the object RobotTelemetryDelta that will be copied.
+     */
+    eProsima_user_DllExport RobotTelemetryDelta& operator =(
+            RobotTelemetryDelta&& x) noexcept
+    {
+
+        m_id = std::move(x.m_id);
+        m_frame = std::move(x.m_frame);
+        return *this;
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x RobotTelemetryDelta object to compare.
+     */
+    eProsima_user_DllExport bool operator ==(
+            const RobotTelemetryDelta& x) const
+    {
+        return (m_id == x.m_id &&
+           m_frame == x.m_frame);
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x RobotTelemetryDelta object to compare.
+     */
+    eProsima_user_DllExport bool operator !=(
+            const RobotTelemetryDelta& x) const
+    {
+        return !(*this == x);
+    }
+
+    /*!
+     * @brief This function copies the value in member id
+     * @param _id New value to be copied in member id
+     */
+    eProsima_user_DllExport void id(
+            const std::string& _id)
+    {
+        m_id = _id;
+    }
+
+    /*!
+     * @brief This function moves the value in member id
+     * @param _id New value to be moved in member id
+     */
+    eProsima_user_DllExport void id(
+            std::string&& _id)
+    {
+        m_id = std::move(_id);
+    }
+
+    /*!
+     * @brief This function returns a constant reference to member id
+     * @return Constant reference to member id
+     */
+    eProsima_user_DllExport const std::string& id() const
+    {
+        return m_id;
+    }
+
+    /*!
+     * @brief This function returns a reference to member id
+     * @return Reference to member id
+     */
+    eProsima_user_DllExport std::string& id()
+    {
+        return m_id;
+    }
+
+
+    /*!
+     * @brief This function copies the value in member frame
+     * @param _frame New value to be copied in member frame
+     */
+    eProsima_user_DllExport void frame(
+            const std::vector<uint8_t>& _frame)
+    {
+        m_frame = _frame;
+    }
+
+    /*!
+     * @brief This function moves the value in member frame
+     * @param _frame New value to be moved in member frame
+     */
+    eProsima_user_DllExport void frame(
+            std::vector<uint8_t>&& _frame)
+    {
+        m_frame = std::move(_frame);
+    }
+
+    /*!
+     * @brief This function returns a constant reference to member frame
+     * @return Constant reference to member frame
+     */
+    eProsima_user_DllExport const std::vector<uint8_t>& frame() const
+    {
+        return m_frame;
+    }
+
+    /*!
+     * @brief This function returns a reference to member frame
+     * @return Reference to member frame
+     */
+    eProsima_user_DllExport std::vector<uint8_t>& frame()
+    {
+        return m_frame;
+    }
+
+
+
+
+private:
+
+    std::string m_id;
+    std::vector<uint8_t> m_frame;
+
+};
+
+#endif // _FAST_DDS_GENERATED_ROBOTTELEMETRYDELTA_HPP_
+
+
@@ -0,0 +1,192 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file RobotTelemetryDeltaBatch.hpp
+ * This header file contains the declaration of the described types in the IDL file.
+ *
+ * This file was generated by the tool fastddsgen (version: 4.2.0).
+ */
+
+#ifndef FAST_DDS_GENERATED__ROBOTTELEMETRYDELTABATCH_HPP
+#define FAST_DDS_GENERATED__ROBOTTELEMETRYDELTABATCH_HPP
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include <fastcdr/cdr/fixed_size_string.hpp>
+
+#if defined(_WIN32)
+#if defined(EPROSIMA_USER_DLL_EXPORT)
+#define eProsima_user_DllExport __declspec( dllexport )
+#else
+#define eProsima_user_DllExport
+#endif  // EPROSIMA_USER_DLL_EXPORT
+#else
+#define eProsima_user_DllExport
+#endif  // _WIN32
+
+#if defined(_WIN32)
+#if defined(EPROSIMA_USER_DLL_EXPORT)
+#if defined(ROBOTTELEMETRYDELTABATCH_SOURCE)
+#define ROBOTTELEMETRYDELTABATCH_DllAPI __declspec( dllexport )
+#else
+#define ROBOTTELEMETRYDELTABATCH_DllAPI __declspec( dllimport )
+#endif // ROBOTTELEMETRYDELTABATCH_SOURCE
+#else
+#define ROBOTTELEMETRYDELTABATCH_DllAPI
+#endif  // EPROSIMA_USER_DLL_EXPORT
+#else
+#define ROBOTTELEMETRYDELTABATCH_DllAPI
+#endif // _WIN32
+
+/*!
+ * @brief This class represents the structure RobotTelemetryDeltaBatch defined by the user in the IDL file.
+ * @ingroup RobotTelemetryDeltaBatch
+ */
+class RobotTelemetryDeltaBatch
+{
+public:
+
+    /*!
+     * @brief Default constructor.
+     */
+    eProsima_user_DllExport RobotTelemetryDeltaBatch()
+    {
+    }
+
+    /*!
+     * @brief Default destructor.
+     */
+    eProsima_user_DllExport ~RobotTelemetryDeltaBatch()
+    {
+    }
+
+    /*!
+     * @brief Copy constructor.
+     * @param x Reference to the object RobotTelemetryDeltaBatch that will be copied.
+     */
+    eProsima_user_DllExport RobotTelemetryDeltaBatch(
+            const RobotTelemetryDeltaBatch& x)
+    {
+                    m_records = x.m_records;
+
+    }
+
+    /*!
+     * @brief Move constructor.
+     * @param x Reference to the object RobotTelemetryDeltaBatch that will be copied.
+     */
+    eProsima_user_DllExport RobotTelemetryDeltaBatch(
+            RobotTelemetryDeltaBatch&& x) noexcept
+    {
+        m_records = std::move(x.m_records);
+    }
+
+    /*!
+     * @brief Copy assignment.
+     * @param x Reference to the object RobotTelemetryDeltaBatch that will be copied.
+     */
+    eProsima_user_DllExport RobotTelemetryDeltaBatch& operator =(
+            const RobotTelemetryDeltaBatch& x)
+    {
+
+                    m_records = x.m_records;
+
+        return *this;
+    }
+
+    /*!
+     * @brief Move assignment.
+     * @param x Reference to the object RobotTelemetryDeltaBatch that will be copied.
+     */
+    eProsima_user_DllExport RobotTelemetryDeltaBatch& operator =(
+            RobotTelemetryDeltaBatch&& x) noexcept
+    {
+
+        m_records = std::move(x.m_records);
+        return *this;
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x RobotTelemetryDeltaBatch object to compare.
+     */
+    eProsima_user_DllExport bool operator ==(
+            const RobotTelemetryDeltaBatch& x) const
+    {
+        return (m_records == x.m_records);
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x RobotTelemetryDeltaBatch object to compare.
+     */
+    eProsima_user_DllExport bool operator !=(
+            const RobotTelemetryDeltaBatch& x) const
+    {
+        return !(*this == x);
+    }
+
+    /*!
+     * @brief This function copies the value in member records
+     * @param _records New value to be copied in member records
+     */
+    eProsima_user_DllExport void records(
+            const std::vector<uint8_t>& _records)
+    {
+        m_records = _records;
+    }
+
+    /*!
+     * @brief This function moves the value in member records
+     * @param _records New value to be moved in member records
+     */
+    eProsima_user_DllExport void records(
+            std::vector<uint8_t>&& _records)
+    {
+        m_records = std::move(_records);
+    }
+
+    /*!
+     * @brief This function returns a constant reference to member records
+     * @return Constant reference to member records
+     */
+    eProsima_user_DllExport const std::vector<uint8_t>& records() const
+    {
+        return m_records;
+    }
+
+    /*!
+     * @brief This function returns a reference to member records
+     * @return Reference to member records
+     */
+    eProsima_user_DllExport std::vector<uint8_t>& records()
+    {
+        return m_records;
+    }
+
+
+
+
+private:
+
+    std::vector<uint8_t> m_records;
+
+};
+
+#endif // _FAST_DDS_GENERATED_ROBOTTELEMETRYDELTABATCH_HPP_
+
+
@@ -0,0 +1,446 @@
+// Copyright 2016 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file RobotTelemetryPlain.hpp
+ * This header file contains the declaration of the described types in the IDL file.
+ *
+ * This file was generated by the tool fastddsgen (version: 4.2.0).
+ */
+
+#ifndef FAST_DDS_GENERATED__ROBOTTELEMETRYPLAIN_HPP
+#define FAST_DDS_GENERATED__ROBOTTELEMETRYPLAIN_HPP
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include "RobotStatus.hpp"
+
+#if defined(_WIN32)
+#if defined(EPROSIMA_USER_DLL_EXPORT)
+#define eProsima_user_DllExport __declspec( dllexport )
+#else
+#define eProsima_user_DllExport
+#endif  // EPROSIMA_USER_DLL_EXPORT
+#else
+#define eProsima_user_DllExport
+#endif  // _WIN32
+
+#if defined(_WIN32)
+#if defined(EPROSIMA_USER_DLL_EXPORT)
+#if defined(ROBOTTELEMETRYPLAIN_SOURCE)
+#define ROBOTTELEMETRYPLAIN_DllAPI __declspec( dllexport )
+#else
+#define ROBOTTELEMETRYPLAIN_DllAPI __declspec( dllimport )
+#endif // ROBOTTELEMETRYPLAIN_SOURCE
+#else
+#define ROBOTTELEMETRYPLAIN_DllAPI
+#endif  // EPROSIMA_USER_DLL_EXPORT
+#else
+#define ROBOTTELEMETRYPLAIN_DllAPI
+#endif // _WIN32
+
+/*!
+ * @brief This class represents the structure RobotTelemetryPlain defined by the user in the IDL file.
+ * @ingroup RobotTelemetryPlain
+ */
+class RobotTelemetryPlain
+{
+public:
+
+    /*!
+     * @brief Default constructor.
+     */
+    eProsima_user_DllExport RobotTelemetryPlain()
+    {
+    }
+
+    /*!
+     * @brief Default destructor.
+     */
+    eProsima_user_DllExport ~RobotTelemetryPlain()
+    {
+    }
+
+    /*!
+     * @brief Copy constructor.
+     * @param x Reference to the object RobotTelemetryPlain that will be copied.
+     */
+    eProsima_user_DllExport RobotTelemetryPlain(
+            const RobotTelemetryPlain& x)
+    {
+                    m_id = x.m_id;
+
+                    m_x = x.m_x;
+
+                    m_y = x.m_y;
+
+                    m_orientation = x.m_orientation;
+
+                    m_speed = x.m_speed;
+
+                    m_timestamp = x.m_timestamp;
+
+                    m_battery_level = x.m_battery_level;
+
+                    m_status = x.m_status;
+
+    }
+
+    /*!
+     * @brief Move constructor.
+     * @param x Reference to the object RobotTelemetryPlain that will be copied.
+     */
+    eProsima_user_DllExport RobotTelemetryPlain(
+            RobotTelemetryPlain&& x) noexcept
+    {
+        m_id = std::move(x.m_id);
+        m_x = x.m_x;
+        m_y = x.m_y;
+        m_orientation = x.m_orientation;
+        m_speed = x.m_speed;
+        m_timestamp = x.m_timestamp;
+        m_battery_level = x.m_battery_level;
+        m_status = x.m_status;
+    }
+
+    /*!
+     * @brief Copy assignment.
+     * @param x Reference to the object RobotTelemetryPlain that will be copied.
+     */
+    eProsima_user_DllExport RobotTelemetryPlain& operator =(
+            const RobotTelemetryPlain& x)
+    {
+
+                    m_id = x.m_id;
+
+                    m_x = x.m_x;
+
+                    m_y = x.m_y;
+
+                    m_orientation = x.m_orientation;
+
+                    m_speed = x.m_speed;
+
+                    m_timestamp = x.m_timestamp;
+
+                    m_battery_level = x.m_battery_level;
+
+                    m_status = x.m_status;
+
+        return *this;
+    }
+
+    /*!
+     * @brief Move assignment.
+     * @param x Reference to the object RobotTelemetryPlain that will be copied.
+     */
+    eProsima_user_DllExport RobotTelemetryPlain& operator =(
+            RobotTelemetryPlain&& x) noexcept
+    {
+
+        m_id = std::move(x.m_id);
+        m_x = x.m_x;
+        m_y = x.m_y;
+        m_orientation = x.m_orientation;
+        m_speed = x.m_speed;
+        m_timestamp = x.m_timestamp;
+        m_battery_level = x.m_battery_level;
+        m_status = x.m_status;
+        return *this;
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x RobotTelemetryPlain object to compare.
+     */
+    eProsima_user_DllExport bool operator ==(
+            const RobotTelemetryPlain& x) const
+    {
+        return (m_id == x.m_id &&
+           m_x == x.m_x &&
+           m_y == x.m_y &&
+           m_orientation == x.m_orientation &&
+           m_speed == x.m_speed &&
+           m_timestamp == x.m_timestamp &&
+           m_battery_level == x.m_battery_level &&
+           m_status == x.m_status);
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x RobotTelemetryPlain object to compare.
+     */
+    eProsima_user_DllExport bool operator !=(
+            const RobotTelemetryPlain& x) const
+    {
+        return !(*this == x);
+    }
+
+    /*!
+     * @brief This function copies the value in member id
+     * @param _id New value to be copied in member id
+     */
+    eProsima_user_DllExport void id(
+            const std::array<char, 16>& _id)
+    {
+        m_id = _id;
+    }
+
+    /*!
+     * @brief This function moves the value in member id
+     * @param _id New value to be moved in member id
+     */
+    eProsima_user_DllExport void id(
+            std::array<char, 16>&& _id)
+    {
+        m_id = std::move(_id);
+    }
+
+    /*!
+     * @brief This function returns a constant reference to member id
+     * @return Constant reference to member id
+     */
+    eProsima_user_DllExport const std::array<char, 16>& id() const
+    {
+        return m_id;
+    }
+
+    /*!
+     * @brief This function returns a reference to member id
+     * @return Reference to member id
+     */
+    eProsima_user_DllExport std::array<char, 16>& id()
+    {
+        return m_id;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member x
+     * @param _x New value for member x
+     */
+    eProsima_user_DllExport void x(
+            double _x)
+    {
+        m_x = _x;
+    }
+
+    /*!
+     * @brief This function returns the value of member x
+     * @return Value of member x
+     */
+    eProsima_user_DllExport double x() const
+    {
+        return m_x;
+    }
+
+    /*!
+     * @brief This function returns a reference to member x
+     * @return Reference to member x
+     */
+    eProsima_user_DllExport double& x()
+    {
+        return m_x;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member y
+     * @param _y New value for member y
+     */
+    eProsima_user_DllExport void y(
+            double _y)
+    {
+        m_y = _y;
+    }
+
+    /*!
+     * @brief This function returns the value of member y
+     * @return Value of member y
+     */
+    eProsima_user_DllExport double y() const
+    {
+        return m_y;
+    }
+
+    /*!
+     * @brief This function returns a reference to member y
+     * @return Reference to member y
+     */
+    eProsima_user_DllExport double& y()
+    {
+        return m_y;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member orientation
+     * @param _orientation New value for member orientation
+     */
+    eProsima_user_DllExport void orientation(
+            double _orientation)
+    {
+        m_orientation = _orientation;
+    }
+
+    /*!
+     * @brief This function returns the value of member orientation
+     * @return Value of member orientation
+     */
+    eProsima_user_DllExport double orientation() const
+    {
+        return m_orientation;
+    }
+
+    /*!
+     * @brief This function returns a reference to member orientation
+     * @return Reference to member orientation
+     */
+    eProsima_user_DllExport double& orientation()
+    {
+        return m_orientation;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member speed
+     * @param _speed New value for member speed
+     */
+    eProsima_user_DllExport void speed(
+            double _speed)
+    {
+        m_speed = _speed;
+    }
+
+    /*!
+     * @brief This function returns the value of member speed
+     * @return Value of member speed
+     */
+    eProsima_user_DllExport double speed() const
+    {
+        return m_speed;
+    }
+
+    /*!
+     * @brief This function returns a reference to member speed
+     * @return Reference to member speed
+     */
+    eProsima_user_DllExport double& speed()
+    {
+        return m_speed;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member timestamp
+     * @param _timestamp New value for member timestamp
+     */
+    eProsima_user_DllExport void timestamp(
+            uint64_t _timestamp)
+    {
+        m_timestamp = _timestamp;
+    }
+
+    /*!
+     * @brief This function returns the value of member timestamp
+     * @return Value of member timestamp
+     */
+    eProsima_user_DllExport uint64_t timestamp() const
+    {
+        return m_timestamp;
+    }
+
+    /*!
+     * @brief This function returns a reference to member timestamp
+     * @return Reference to member timestamp
+     */
+    eProsima_user_DllExport uint64_t& timestamp()
+    {
+        return m_timestamp;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member battery_level
+     * @param _battery_level New value for member battery_level
+     */
+    eProsima_user_DllExport void battery_level(
+            float _battery_level)
+    {
+        m_battery_level = _battery_level;
+    }
+
+    /*!
+     * @brief This function returns the value of member battery_level
+     * @return Value of member battery_level
+     */
+    eProsima_user_DllExport float battery_level() const
+    {
+        return m_battery_level;
+    }
+
+    /*!
+     * @brief This function returns a reference to member battery_level
+     * @return Reference to member battery_level
+     */
+    eProsima_user_DllExport float& battery_level()
+    {
+        return m_battery_level;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member status
+     * @param _status New value for member status
+     */
+    eProsima_user_DllExport void status(
+            RobotStatus _status)
+    {
+        m_status = _status;
+    }
+
+    /*!
+     * @brief This function returns the value of member status
+     * @return Value of member status
+     */
+    eProsima_user_DllExport RobotStatus status() const
+    {
+        return m_status;
+    }
+
+    /*!
+     * @brief This function returns a reference to member status
+     * @return Reference to member status
+     */
+    eProsima_user_DllExport RobotStatus& status()
+    {
+        return m_status;
+    }
+
+
+private:
+
+    std::array<char, 16> m_id{0};
+    double m_x{0.0};
+    double m_y{0.0};
+    double m_orientation{0.0};
+    double m_speed{0.0};
+    uint64_t m_timestamp{0};
+    float m_battery_level{0.0};
+    RobotStatus m_status{RobotStatus::UNKNOWN};
+
+};
+
+#endif // _FAST_DDS_GENERATED_ROBOTTELEMETRYPLAIN_HPP_
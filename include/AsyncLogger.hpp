@@ -0,0 +1,144 @@
+#ifndef ASYNC_LOGGER_HPP
+#define ASYNC_LOGGER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Asynchronous console logger for the hot paths (publish loop, reader)
+ *
+ * Producers copy a small trivially copyable record plus a format function
+ * into a bounded lock-free ring (multi-producer, one consumer) and return;
+ * a background thread formats the records and writes them to std::cout,
+ * flushing once per batch instead of once per line. When the ring is full
+ * the record is dropped and counted, so console I/O never blocks a producer.
+ * Records pushed while stop() drains are dropped and counted the same way
+ * (the last drain waits for the pushes already in flight): stop the
+ * components that log before the logger.
+ *
+ * Each category can be sampled "1 in N per key" (the key is usually the
+ * robot id). Until start() is called records are formatted synchronously.
+ */
+class AsyncLogger
+{
+public:
+    enum class Category : uint8_t
+    {
+        GENERAL,
+        PUBLISHER,
+        SUBSCRIBER,
+        TELEMETRY,
+        COUNT
+    };
+
+    // bytes available for one record
+    static constexpr std::size_t kPayloadSize = 232;
+
+    static AsyncLogger& instance();
+
+    // capacity is rounded up to a power of two
+    void start(std::size_t capacity = 8192);
+    // drains what is queued, then joins the writer thread
+    void stop();
+    bool isRunning() const { return running_.load(std::memory_order_acquire); }
+
+    // log 1 in `every` records of this category for each key (1 = all, 0 = none)
+    void setSampling(Category category, uint32_t every);
+
+    // `--log-every N` from the command line, or default_every
+    static uint32_t samplingFromArgs(int argc, char** argv, uint32_t default_every);
+
+    // sampling decision for `key`; call before building the record
+    bool sample(Category category, const std::string& key);
+
+    template<typename T>
+    bool log(Category category, void (*format)(const T&, std::ostream&), const T& payload)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "log records are copied with memcpy");
+        static_assert(sizeof(T) <= kPayloadSize, "log record too large");
+        static_assert(sizeof(Record<T>) <= kRecordSize, "log record too large");
+
+        Record<T> record;
+        record.format = format;
+        record.payload = payload;
+        return push(category, &AsyncLogger::callFormat<T>, &record, sizeof(record));
+    }
+
+    // plain text line (truncated to the payload size)
+    bool text(Category category, const std::string& line);
+
+    uint64_t getDropped() const { return dropped_.load(std::memory_order_relaxed); }
+    uint64_t getWritten() const { return written_.load(std::memory_order_relaxed); }
+
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+private:
+    // a payload and its typed format function, so nothing is cast
+    template<typename T>
+    struct Record
+    {
+        void (*format)(const T&, std::ostream&);
+        T payload;
+    };
+
+    // formats the Record<T> copied into a slot; one instantiation per T
+    using Trampoline = void (*)(const void* record, std::ostream& out);
+
+    static constexpr std::size_t kRecordSize = kPayloadSize + sizeof(void (*)());
+
+    struct Slot
+    {
+        std::atomic<std::size_t> sequence;
+        Trampoline trampoline;
+        Category category;
+        alignas(8) unsigned char record[kRecordSize];
+    };
+
+    // per-category, per-key sample counters (keys hashed into a fixed table)
+    static constexpr std::size_t kSampleSlots = 4096;
+
+    std::vector<Slot> slots_;
+    std::size_t mask_;
+    alignas(64) std::atomic<std::size_t> enqueue_pos_;
+    alignas(64) std::size_t dequeue_pos_;
+
+    std::atomic<bool> running_;
+    std::atomic<bool> stopping_;
+    // push() calls between their stopping_ check and publishing their slot
+    alignas(64) std::atomic<uint32_t> producers_;
+    std::thread writer_;
+
+    std::atomic<uint32_t> sampling_[static_cast<std::size_t>(Category::COUNT)];
+    std::vector<std::atomic<uint32_t>> sample_counters_;
+
+    std::atomic<uint64_t> dropped_;
+    std::atomic<uint64_t> written_;
+
+    AsyncLogger();
+    ~AsyncLogger();
+
+    template<typename T>
+    static void callFormat(const void* record, std::ostream& out)
+    {
+        Record<T> typed;
+        std::memcpy(&typed, record, sizeof(typed));
+        typed.format(typed.payload, out);
+    }
+
+    bool push(Category category, Trampoline trampoline, const void* record, std::size_t size);
+    // false if the ring is full
+    bool enqueue(Category category, Trampoline trampoline, const void* record, std::size_t size);
+    void writerLoop();
+    // formats and writes everything queued, returns the number of records
+    std::size_t drain();
+};
+
+#endif // ASYNC_LOGGER_HPP
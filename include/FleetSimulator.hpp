@@ -0,0 +1,156 @@
+#ifndef FLEET_SIMULATOR_HPP
+#define FLEET_SIMULATOR_HPP
+
+#include "RobotTelemetry.hpp"
+#include "RobotSimulator.hpp"
+#include "SimdKernels.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Simulator for a whole fleet of robots
+ *
+ * Same motion and battery models as RobotSimulator, but the state of all
+ * robots is kept in struct-of-arrays buffers (one vector per field) and
+ * update() steps every robot in a single pass over those buffers.
+ * Robots are addressed by the index returned from addRobot().
+ *
+ * Circular robots with the same angular velocity are on the same phase at
+ * any time, so cos/sin/heading are computed once per distinct angular
+ * velocity ("phase group") per tick instead of once per robot. A circular
+ * robot's position and heading are then a closed-form function of its group
+ * (center + radius * cos/sin), so update() doesn't store them per robot:
+ * getX()/getY()/getOrientation()/fillTelemetry() evaluate them on read, the
+ * same way for every reader. The same holds for the (constant) heading of a
+ * linear robot. Only state that accumulates is stepped per robot: linear
+ * positions, over a sorted index list of the linear robots (no per-robot
+ * branch on the motion mode), and the battery.
+ *
+ * The phase and battery updates run through SimdKernels (AVX2 when the CPU
+ * has it, see SimdKernels.hpp for the tolerance against the scalar models).
+ */
+class FleetSimulator
+{
+public:
+    using MotionMode = RobotSimulator::MotionMode;
+
+    FleetSimulator();
+
+    // preallocate buffers for `count` robots
+    void reserve(std::size_t count);
+
+    // add a robot with the RobotSimulator defaults, returns its index
+    std::size_t addRobot(const std::string& robot_id);
+
+    //update all robots by one time step
+    // dt = time in sec ( 0.1 for 100ms)
+    void update(double dt);
+
+    RobotTelemetry generateTelemetry(std::size_t index) const;
+    // fill an existing sample in place (e.g. a DataWriter loan)
+    void fillTelemetry(std::size_t index, RobotTelemetry& telemetry) const;
+
+    void setCircularMotion(std::size_t index, double radius, double angular_velocity);
+    void setLinearMotion(std::size_t index, double velocity, double angle);
+    void setStationary(std::size_t index, double x, double y);
+    void setBatteryDrainRate(std::size_t index, float rate);
+    void setBatteryChargeRate(std::size_t index, float rate);
+    void setLowBatteryThreshold(std::size_t index, float threshold);
+    void setBatteryLevel(std::size_t index, float level);
+    //reset every robot to initial state
+    void reset();
+
+    // building blocks of update(), FleetStepper uses them to split a tick
+    // across threads: phase groups first, then robot ranges, then the clock.
+    // Every robot (and group) is computed independently of the range it is in.
+    std::size_t phaseGroupCount() const { return group_angular_velocity_.size(); }
+    void updatePhaseGroups(std::size_t begin, std::size_t end);
+    void updateRange(std::size_t begin, std::size_t end, double dt);
+    void advanceTime(double dt);
+
+    // kernels used by update(), defaults to the best one the CPU supports
+    void setKernelIsa(SimdKernels::Isa isa) { isa_ = isa; }
+    SimdKernels::Isa getKernelIsa() const { return isa_; }
+
+    std::size_t size() const { return ids_.size(); }
+    double getSimulationTime() const { return time_; }
+
+    const std::string& getId(std::size_t index) const { return ids_[index]; }
+    MotionMode getMotionMode(std::size_t index) const { return static_cast<MotionMode>(motion_mode_[index]); }
+    double getX(std::size_t index) const;
+    double getY(std::size_t index) const;
+    double getOrientation(std::size_t index) const;
+    double getSpeed(std::size_t index) const { return velocity_[index]; }
+    double getAngularVelocity(std::size_t index) const { return angular_velocity_[index]; }
+    float getBatteryLevel(std::size_t index) const { return battery_level_[index]; }
+    bool isCharging(std::size_t index) const { return is_charging_[index] != 0; }
+
+private:
+    std::vector<std::string> ids_;
+
+    std::vector<double> x_;
+    std::vector<double> y_;
+    std::vector<double> orientation_;
+
+    std::vector<uint8_t> motion_mode_;
+    // indices of the linear robots, sorted, the only ones updateMotion() steps
+    std::vector<uint32_t> linear_robots_;
+    // 1 while a robot reads its stored x/y/orientation: its motion was set
+    // (or the fleet reset) since the last update
+    std::vector<uint8_t> pending_;
+    bool has_pending_;
+    std::vector<double> velocity_;
+    std::vector<double> angular_velocity_;
+    std::vector<double> motion_angle_;
+    // velocity * cos/sin(motion_angle), cached when linear motion is set
+    std::vector<double> linear_vx_;
+    std::vector<double> linear_vy_;
+
+    std::vector<double> circle_radius_;
+    std::vector<double> circle_center_x_;
+    std::vector<double> circle_center_y_;
+    std::vector<uint32_t> phase_group_;
+
+    // phase groups: one entry per distinct angular velocity
+    std::unordered_map<double, uint32_t> group_index_;
+    std::vector<double> group_angular_velocity_;
+    std::vector<double> group_cos_;
+    std::vector<double> group_sin_;
+    std::vector<double> group_orientation_;
+
+    std::vector<float> battery_level_;
+    std::vector<float> battery_drain_rate_;
+    std::vector<float> battery_charge_rate_;
+    std::vector<float> low_battery_threshold_;
+    std::vector<uint8_t> is_charging_;
+    // isMoving() as of the last update, what the battery kernel drains by
+    std::vector<uint8_t> moving_;
+
+    // all robots share the simulation clock
+    double time_;
+
+    SimdKernels::Isa isa_;
+
+    // robots stepped per block in update()
+    static constexpr std::size_t kBlockSize = 1024;
+
+    bool isMoving(std::size_t index) const;
+    void updateMotion(std::size_t begin, std::size_t end, double dt);
+    void resolvePending(std::size_t begin, std::size_t end);
+    void materialize(std::size_t index);
+    void setMotionMode(std::size_t index, MotionMode mode);
+    std::size_t linearListPosition(std::size_t index) const;
+
+    // position / heading derived from the motion mode, see the class comment
+    bool isDerived(std::size_t index, MotionMode mode) const
+    {
+        return pending_[index] == 0 && motion_mode_[index] == static_cast<uint8_t>(mode);
+    }
+
+    uint32_t phaseGroup(double angular_velocity);
+};
+
+#endif // FLEET_SIMULATOR_HPP
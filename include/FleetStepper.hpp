@@ -0,0 +1,79 @@
+#ifndef FLEET_STEPPER_HPP
+#define FLEET_STEPPER_HPP
+
+#include "FleetSimulator.hpp"
+#include "WorkerPool.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Steps a FleetSimulator on a WorkerPool
+ *
+ * Each tick the phase groups and then the robots are split into one
+ * contiguous range per worker, starting on a multiple of 64 robots so two
+ * workers never write into the same cache line.
+ * Every robot is computed independently of the range it falls into, so the
+ * fleet state after step() is bit-identical for any number of threads.
+ *
+ * Workers are pinned to cores (worker i -> core i % cores) when requested.
+ * Per-tick wall time and per-worker busy time are recorded to size hosts.
+ */
+class FleetStepper
+{
+public:
+    // called by each worker for its robot range after it has been stepped
+    // (e.g. to build telemetry for those robots)
+    using RangeCallback = std::function<void(std::size_t worker, std::size_t begin, std::size_t end)>;
+
+    struct TickStats
+    {
+        double wall_us;          // step() duration
+        double max_worker_us;    // slowest worker
+        double mean_worker_us;   // average worker
+        double imbalance;        // max / mean (1.0 = perfect split)
+    };
+
+    FleetStepper(FleetSimulator& fleet, std::size_t threads, bool pin_threads = true);
+    ~FleetStepper();
+
+    FleetStepper(const FleetStepper&) = delete;
+    FleetStepper& operator=(const FleetStepper&) = delete;
+
+    //update the whole fleet by one time step
+    void step(double dt, const RangeCallback& after_step = RangeCallback());
+
+    std::size_t getThreadCount() const { return pool_.getThreadCount(); }
+
+    const TickStats& getLastTick() const { return last_tick_; }
+    // busy time of each worker in the last tick (us)
+    const std::vector<double>& getLastWorkerTimes() const { return worker_us_; }
+
+    void printStats() const;
+    void resetStats();
+
+private:
+    FleetSimulator& fleet_;
+    WorkerPool pool_;
+
+    // the tick's jobs, built once; they read dt_ and after_step_
+    WorkerPool::RangeJob phase_groups_job_;
+    WorkerPool::RangeJob robots_job_;
+    double dt_;
+    const RangeCallback* after_step_;
+
+    // both jobs of the last tick
+    std::vector<double> worker_us_;
+    TickStats last_tick_;
+
+    // accumulated since the last resetStats()
+    uint64_t ticks_;
+    double total_wall_us_;
+    double max_wall_us_;
+    double total_imbalance_;
+
+    void addWorkerTimes();
+};
+
+#endif // FLEET_STEPPER_HPP
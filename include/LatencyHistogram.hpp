@@ -0,0 +1,58 @@
+#ifndef LATENCY_HISTOGRAM_HPP
+#define LATENCY_HISTOGRAM_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Lock-free latency histogram with HDR-style log-linear buckets
+ *
+ * Values below 64 ns have one bucket each; above that every power of two is
+ * split into 64 linear sub-buckets, so a bucket is at most ~1.6 % wide up
+ * to 2^36 ns (~68 s), and larger values go to the last bucket. record() is a
+ * few relaxed atomic adds and can run on any number of threads; summary()
+ * may run at the same time (it sees a slightly moving picture).
+ */
+class LatencyHistogram
+{
+public:
+    static const std::size_t kSubBuckets = 64;
+    static const std::size_t kMaxExponent = 36;
+    static const std::size_t kBuckets = kSubBuckets + (kMaxExponent - 6) * kSubBuckets;
+
+    struct Summary
+    {
+        uint64_t count;
+        uint64_t negative;           // samples with a timestamp in the future (clock skew), recorded as 0
+        double mean_us;
+        double p50_us;
+        double p99_us;
+        double p999_us;
+        double max_us;
+    };
+
+    LatencyHistogram();
+
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    void record(int64_t latency_ns);
+    Summary summary() const;
+    void reset();
+
+    uint64_t getCount() const { return count_.load(std::memory_order_relaxed); }
+
+    static std::size_t bucketOf(uint64_t value_ns);
+    // highest value that falls into the bucket
+    static uint64_t bucketUpper(std::size_t bucket);
+
+private:
+    std::atomic<uint64_t> counts_[kBuckets];
+    std::atomic<uint64_t> count_;
+    std::atomic<uint64_t> negative_;
+    std::atomic<uint64_t> sum_ns_;
+    std::atomic<uint64_t> max_ns_;
+};
+
+#endif // LATENCY_HISTOGRAM_HPP
@@ -0,0 +1,68 @@
+#ifndef LATENCY_TRACKER_HPP
+#define LATENCY_TRACKER_HPP
+
+#include "LatencyHistogram.hpp"
+#include "RobotIndex.hpp"
+#include "RobotTelemetry.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+
+/**
+ * @brief Publish -> receive latency of the telemetry stream, for one QoS profile
+ *
+ * Latency is the receive time (system_clock) minus RobotTelemetry::timestamp,
+ * so publisher and subscriber clocks must be in sync (same host, or PTP/NTP
+ * across hosts). Every sample goes into the profile-wide histogram and into
+ * its robot's histogram (fixed table of max_robots, see RobotIndex; robots
+ * beyond that only count in the profile histogram).
+ *
+ * startReporting() prints p50 / p99 / p99.9 / max every interval: the
+ * profile line plus the robots with the worst p99.
+ */
+class LatencyTracker
+{
+public:
+    LatencyTracker(const std::string& profile, std::size_t max_robots);
+    ~LatencyTracker();
+
+    LatencyTracker(const LatencyTracker&) = delete;
+    LatencyTracker& operator=(const LatencyTracker&) = delete;
+
+    // ingest thread(s)
+    void record(const RobotTelemetry& telemetry);
+    void record(const std::string& id, int64_t latency_ns);
+
+    // periodic report through the AsyncLogger (console)
+    void startReporting(int interval_ms, std::size_t worst_robots = 5);
+    void stopReporting();
+
+    void report(std::ostream& out, std::size_t worst_robots) const;
+
+    const std::string& getProfile() const { return profile_; }
+    const LatencyHistogram& getProfileHistogram() const { return profile_histogram_; }
+    // false if the robot was never seen
+    bool getRobotSummary(const std::string& id, LatencyHistogram::Summary& summary) const;
+
+    static int64_t nowNs();
+
+private:
+    std::string profile_;
+    RobotIndex index_;
+    LatencyHistogram profile_histogram_;
+    std::unique_ptr<LatencyHistogram[]> robot_histograms_;
+
+    std::thread report_thread_;
+    std::mutex report_mutex_;
+    std::condition_variable report_cv_;
+    bool reporting_;
+
+    void reportLoop(int interval_ms, std::size_t worst_robots);
+};
+
+#endif // LATENCY_TRACKER_HPP
@@ -3,6 +3,11 @@
 
 #include <fastdds/dds/publisher/DataWriterListener.hpp>
 #include <fastdds/dds/core/status/PublicationMatchedStatus.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
 
 using namespace eprosima::fastdds::dds;
 
@@ -15,25 +20,56 @@ using namespace eprosima::fastdds::dds;
 class PubListener : public DataWriterListener
 {
 public:
-    PubListener() : matched_(0) {}
+    PubListener() : matched_(0), total_matched_(0), verbose_(true) {}
     ~PubListener() override {}
 
     void on_publication_matched( DataWriter* writer,
         const PublicationMatchedStatus& info) override
     {
+        total_matched_ = info.total_count;
         if(info.current_count_change == 1)
         {
-            matched_ = info.current_count;
-            std::cout<<"[Publisher] Subscriber connected! Total: " << matched_ <<std::endl;
+            setMatched(info.current_count);
+            if (verbose_)
+                std::cout<<"[Publisher] Subscriber connected! Total: " << matched_.load() <<std::endl;
         }
         else if (info.current_count_change == -1)
         {
-            matched_ = info.current_count;
-            std::cout<<"[Publisher] Subscriber disconnected! Total: " << matched_ << std::endl;
+            setMatched(info.current_count);
+            if (verbose_)
+                std::cout<<"[Publisher] Subscriber disconnected! Total: " << matched_.load() << std::endl;
         }
     }
 
-    /// num of currently matched subscribers
-    int matched_;
+    // false: no console output on (un)matching
+    void setVerbose(bool verbose) { verbose_ = verbose; }
+
+    // blocks until at least `count` subscribers are matched; false on timeout
+    bool waitForMatch(int count, std::chrono::milliseconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return matched_cv_.wait_for(lock, timeout, [this, count]() { return matched_ >= count; });
+    }
+
+    /// num of currently matched subscribers; read without the lock from the
+    /// publishing thread, mutex_ only pairs the writes with matched_cv_
+    std::atomic<int> matched_;
+    /// subscribers ever matched (total_count): changes on every new match,
+    /// even when another subscriber left in the meantime
+    std::atomic<int> total_matched_;
+
+private:
+    bool verbose_;
+    std::mutex mutex_;
+    std::condition_variable matched_cv_;
+
+    void setMatched(int count)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            matched_ = count;
+        }
+        matched_cv_.notify_all();
+    }
 };
 #endif
\ No newline at end of file
@@ -4,12 +4,52 @@
 #include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
+#include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.hpp>
+#include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.hpp>
+#include <fastdds/utils/IPLocator.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
 
 
 
 class QoSProfiles 
 {
 public:
+    // robots (instances) the profiles are sized for unless setFleetSize() says
+    // otherwise; Fast DDS defaults to 10 instances
+    static const int32_t kDefaultFleetSize = 1024;
+    // no instance limit (Fast DDS treats limits <= 0 as unlimited)
+    static const int32_t kUnlimitedRobots = -1;
+
+    // fleet size used by the profiles created after this call; the subscriber
+    // sizes its per-robot tables (state store, history, latency) from it too
+    static void setFleetSize(int32_t robots) { fleetSize() = robots > 0 ? robots : kUnlimitedRobots; }
+    static int32_t getFleetSize() { return fleetSize(); }
+
+    // `id` is the topic key, so history depth, deadline and lifespan apply per robot
+    template<typename Qos>
+    static void setPerRobotLimits(Qos& qos)
+    {
+        int32_t robots = getFleetSize();
+        qos.resource_limits().max_instances = robots;
+        if (qos.history().kind == KEEP_LAST_HISTORY_QOS)
+        {
+            qos.resource_limits().max_samples_per_instance = qos.history().depth;
+            qos.resource_limits().max_samples = robots > 0 ? robots * qos.history().depth : kUnlimitedRobots;
+        }
+        else
+        {
+            // KEEP_ALL: the max_samples budget is shared by all robots
+            qos.resource_limits().max_samples_per_instance = qos.resource_limits().max_samples;
+        }
+    }
+
     static DataWriterQos getReliableTransientWriterQoS()
     {
         DataWriterQos qos;
@@ -23,6 +63,8 @@ public:
         qos.history().kind = KEEP_LAST_HISTORY_QOS;
         qos.history().depth =  10; 
 
+        setPerRobotLimits(qos);
+
         return qos;
     }
 
@@ -36,6 +78,8 @@ public:
         qos.history().kind = KEEP_LAST_HISTORY_QOS;
         qos.history().depth = 10;
 
+        setPerRobotLimits(qos);
+
         return qos;
     }
 
@@ -48,6 +92,8 @@ public:
         qos.history().kind = KEEP_LAST_HISTORY_QOS;
         qos.history().depth = 1;
 
+        setPerRobotLimits(qos);
+
         return qos;
     }
 
@@ -60,6 +106,8 @@ public:
         qos.history().kind = KEEP_LAST_HISTORY_QOS;
         qos.history().depth = 1;
 
+        setPerRobotLimits(qos);
+
         return qos;
     }
 
@@ -75,6 +123,8 @@ public:
         // DEADLINE: must send at least one message every 500ms
         qos.deadline().period = eprosima::fastdds::dds::Duration_t(0, 500000000); // 500ms
 
+        setPerRobotLimits(qos);
+
         return qos;
     }
 
@@ -90,6 +140,8 @@ public:
         // DEADLINE: except a message every 500ms, otherwise trigger the callback
         qos.deadline().period = eprosima::fastdds::dds::Duration_t(0, 500000000); // 500ms
 
+        setPerRobotLimits(qos);
+
         return qos;
     }
 
@@ -105,6 +157,8 @@ public:
         // LIFESPAN: messages expiers after 5 minutes
         qos.lifespan().duration = eprosima::fastdds::dds::Duration_t(5, 0); // 5 sec
 
+        setPerRobotLimits(qos);
+
         return qos;
     }
 
@@ -120,6 +174,8 @@ public:
         // reader doesnt set lifespan ( writer policy)
         // but it will automatically ignore expired messages
 
+        setPerRobotLimits(qos);
+
         return qos;
     }
 
@@ -135,6 +191,8 @@ public:
         
         qos.resource_limits().max_samples = 1000;  // Max 1000 messages in buffer
 
+        setPerRobotLimits(qos);
+
         return qos;
     }
 
@@ -147,9 +205,128 @@ public:
         qos.history().kind = KEEP_ALL_HISTORY_QOS;
         qos.resource_limits().max_samples = 1000;
 
+        setPerRobotLimits(qos);
+
         return qos;
     }
 
+    // DATA-SHARING: same-host readers get the sample straight from the writer's
+    // shared history, without serialization or a transport copy.
+    // Only bounded/plain types qualify (RobotTelemetryPlain), automatic() falls
+    // back to the transports for RobotTelemetry or for remote readers.
+    static DataWriterQos getDataSharingWriterQoS()
+    {
+        DataWriterQos qos;
+
+        qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+        qos.durability().kind = VOLATILE_DURABILITY_QOS;
+        qos.history().kind = KEEP_LAST_HISTORY_QOS;
+        qos.history().depth = 16;
+
+        qos.data_sharing().automatic();
+        // the shared segment is sized once from the history, no reallocation
+        qos.endpoint().history_memory_policy = eprosima::fastdds::rtps::PREALLOCATED_MEMORY_MODE;
+
+        setPerRobotLimits(qos);
+
+        return qos;
+    }
+
+    static DataReaderQos getDataSharingReaderQoS()
+    {
+        DataReaderQos qos;
+
+        qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+        qos.durability().kind = VOLATILE_DURABILITY_QOS;
+        qos.history().kind = KEEP_LAST_HISTORY_QOS;
+        qos.history().depth = 16;
+
+        qos.data_sharing().automatic();
+        qos.endpoint().history_memory_policy = eprosima::fastdds::rtps::PREALLOCATED_MEMORY_MODE;
+
+        setPerRobotLimits(qos);
+
+        return qos;
+    }
+
+    // participant with only the UDPv4 transport (no SHM), to measure the network path
+    static DomainParticipantQos getUdpOnlyParticipantQoS()
+    {
+        DomainParticipantQos pqos;
+
+        pqos.transport().use_builtin_transports = false;
+        pqos.transport().user_transports.push_back(
+            std::make_shared<eprosima::fastdds::rtps::UDPv4TransportDescriptor>());
+
+        return pqos;
+    }
+
+    // participant with only the shared-memory transport (same host only)
+    static DomainParticipantQos getShmOnlyParticipantQoS()
+    {
+        DomainParticipantQos pqos;
+
+        pqos.transport().use_builtin_transports = false;
+        pqos.transport().user_transports.push_back(
+            std::make_shared<eprosima::fastdds::rtps::SharedMemTransportDescriptor>());
+
+        return pqos;
+    }
+
+    // static discovery: no multicast SPDP, the participant announces itself straight
+    // to `peers` ("a.b.c.d", or "a.b.c.d:port" for one participant's SPDP port;
+    // without a port the first participants of domain 0 on that host are tried).
+    // Announcements are tuned for a fast join: a burst of 10, 20 ms apart, then
+    // every second (Fast DDS: 5 at 100 ms, then 3 s); a peer that goes silent is
+    // dropped after 10 s instead of 20. Every participant of the system needs
+    // this profile and the others' addresses (127.0.0.1 on one host).
+    static DomainParticipantQos getStaticPeersParticipantQoS(const std::vector<std::string>& peers)
+    {
+        DomainParticipantQos pqos;
+        auto& builtin = pqos.wire_protocol().builtin;
+
+        for (const std::string& peer : peers)
+        {
+            std::size_t colon = peer.find(':');
+            eprosima::fastdds::rtps::Locator_t locator;
+            if (!eprosima::fastdds::rtps::IPLocator::setIPv4(locator, peer.substr(0, colon)))
+            {
+                std::cerr << "[QoS] Ignoring initial peer " << peer << " (not an IPv4 address)" << std::endl;
+                continue;
+            }
+            if (colon != std::string::npos)
+                locator.port = static_cast<uint32_t>(std::strtoul(peer.c_str() + colon + 1, nullptr, 10));
+            builtin.initialPeersList.push_back(locator);
+        }
+
+        // an explicit metatraffic unicast locator (any address, default port) and no
+        // multicast one: discovery stays unicast
+        builtin.metatrafficUnicastLocatorList.push_back(eprosima::fastdds::rtps::Locator_t());
+        builtin.avoid_builtin_multicast = true;
+
+        builtin.discovery_config.initial_announcements.count = 10;
+        builtin.discovery_config.initial_announcements.period = Duration_t(0, 20000000);
+        builtin.discovery_config.leaseDuration_announcementperiod = Duration_t(1, 0);
+        builtin.discovery_config.leaseDuration = Duration_t(10, 0);
+
+        return pqos;
+    }
+
+    // "a,b,c" -> {"a", "b", "c"}, e.g. a --peers command line value
+    static std::vector<std::string> splitPeers(const std::string& list)
+    {
+        std::vector<std::string> peers;
+        std::size_t begin = 0;
+        while (begin <= list.size())
+        {
+            std::size_t end = std::min(list.find(',', begin), list.size());
+            if (end > begin)
+                peers.push_back(list.substr(begin, end - begin));
+            begin = end + 1;
+        }
+        return peers;
+    }
+
     static void printQoSInfo(const DataWriterQos& qos, const std::string& name = "Writer")
     {
         std::cout << "\n=== QoS Profile: " << name << " ===" << std::endl;
@@ -203,6 +380,12 @@ public:
         std::cout << "================================\n" << std::endl;
     }
 
+private:
+    static int32_t& fleetSize()
+    {
+        static int32_t robots = kDefaultFleetSize;
+        return robots;
+    }
 };
 
 #endif // QOS_PROFILES_HPP
\ No newline at end of file
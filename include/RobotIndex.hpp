@@ -0,0 +1,56 @@
+#ifndef ROBOT_INDEX_HPP
+#define ROBOT_INDEX_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Fixed-capacity map from robot id to a dense robot number
+ *
+ * Robots are numbered 0, 1, 2... in the order they are first seen, so
+ * per-robot data can live in flat arrays indexed by that number. Lookups
+ * are lock-free (open addressing, load factor <= 0.5); only adding a new
+ * id takes a mutex. Ids are never removed.
+ */
+class RobotIndex
+{
+public:
+    // ids up to kIdSize - 1 characters
+    static constexpr std::size_t kIdSize = 32;
+
+    explicit RobotIndex(std::size_t max_robots);
+
+    RobotIndex(const RobotIndex&) = delete;
+    RobotIndex& operator=(const RobotIndex&) = delete;
+
+    // robot number of `id`, or capacity() if unknown
+    std::size_t find(const std::string& id) const;
+    // find, or add a new id; capacity() if the id is empty/too long or the index is full
+    std::size_t insert(const std::string& id);
+
+    // id of a robot number below size() (nul-terminated, kIdSize bytes)
+    const char* id(std::size_t robot) const { return &ids_[robot * kIdSize]; }
+
+    std::size_t size() const { return size_.load(std::memory_order_acquire); }
+    std::size_t capacity() const { return capacity_; }
+    std::size_t memoryBytes() const;
+
+private:
+    static const uint32_t kEmpty = 0;                // entry: 0 or robot + 1
+
+    std::size_t capacity_;
+    std::vector<char> ids_;                          // written once per robot, before it is published
+    std::vector<std::atomic<uint32_t>> entries_;
+    std::size_t mask_;
+    std::atomic<std::size_t> size_;
+    std::mutex insert_mutex_;
+
+    static uint64_t hashId(const char* id, std::size_t length);
+    std::size_t find(const char* id, std::size_t length, uint64_t hash) const;
+};
+
+#endif // ROBOT_INDEX_HPP
@@ -0,0 +1,143 @@
+#ifndef ROBOT_MODELS_HPP
+#define ROBOT_MODELS_HPP
+
+#include "RobotStatus.hpp"
+#include <cmath>
+
+/**
+ * @brief Motion and battery models shared by the simulators
+ *
+ * RobotSimulator (one robot) and FleetSimulator (many robots in
+ * struct-of-arrays buffers) both step through these functions, so a robot
+ * behaves the same whichever simulator drives it.
+ */
+namespace RobotModels
+{
+    // phase of a circular trajectory: cos/sin of the angle and the heading (tangent)
+    inline void circularPhase(
+        double angle,
+        double& cos_angle, double& sin_angle, double& orientation)
+    {
+        cos_angle = std::cos(angle);
+        sin_angle = std::sin(angle);
+
+        orientation = angle + M_PI / 2.0;
+
+        while (orientation > 2 * M_PI)
+            orientation -= 2 * M_PI;
+        while (orientation < 0)
+            orientation += 2 * M_PI;
+    }
+
+    inline double circularSpeed(double radius, double angular_velocity)
+    {
+        return radius * std::abs(angular_velocity);
+    }
+
+    // position on the circle for a phase computed by circularPhase()
+    inline void circularPosition(
+        double cos_angle, double sin_angle,
+        double center_x, double center_y,
+        double radius, double angular_velocity,
+        double& x, double& y, double& velocity)
+    {
+        x = center_x + radius * cos_angle;
+        y = center_y + radius * sin_angle;
+
+        velocity = circularSpeed(radius, angular_velocity);
+    }
+
+    // circular motion around (center_x, center_y); angle = angular_velocity * time
+    inline void circularStep(
+        double angle,
+        double center_x, double center_y,
+        double radius, double angular_velocity,
+        double& x, double& y, double& orientation, double& velocity)
+    {
+        double cos_angle, sin_angle;
+
+        circularPhase(angle, cos_angle, sin_angle, orientation);
+        circularPosition(cos_angle, sin_angle, center_x, center_y, radius, angular_velocity,
+                         x, y, velocity);
+    }
+
+    // linear motion; vx/vy = velocity * cos/sin(motion_angle), so they can be cached
+    inline void linearPosition(double vx, double vy, double dt, double& x, double& y)
+    {
+        x += vx * dt;
+        y += vy * dt;
+    }
+
+    inline void linearStep(
+        double vx, double vy, double motion_angle, double dt,
+        double& x, double& y, double& orientation)
+    {
+        linearPosition(vx, vy, dt, x, y);
+
+        orientation = motion_angle;
+    }
+
+    // moving = robot is not stationary and has a positive velocity
+    inline void batteryStep(
+        double dt, bool moving,
+        float drain_rate, float charge_rate,
+        float& level, bool& charging)
+    {
+        if (charging)
+        {
+            //charging
+            level += charge_rate * dt;
+
+            if (level >= 100.0f)
+            {
+                level = 100.0f;
+                charging = false;
+            }
+        }
+        else
+        {
+            //discharge only if robot is moving
+            if (moving)
+            {
+                level -= drain_rate * dt;
+
+                if (level <= 0.0f)
+                {
+                    level = 0.0f;
+                    charging = true;
+                }
+            }
+        }
+    }
+
+    // Priority: CHARGING > LOW_BATTERY > DISCHARGED > motion
+    inline RobotStatus status(bool charging, float level, float low_threshold, bool moving)
+    {
+        if (charging)
+            return RobotStatus::CHARGING;
+
+        if (level <= low_threshold && level > 0.0f)
+            return RobotStatus::LOW_BATTERY;
+
+        if (level <= 0.0f)
+            return RobotStatus::DISCHARGED;
+
+        return moving ? RobotStatus::MOVING : RobotStatus::IDLE;
+    }
+
+    inline const char* statusName(RobotStatus status)
+    {
+        switch (status)
+        {
+            case RobotStatus::IDLE:        return "IDLE";
+            case RobotStatus::MOVING:      return "MOVING";
+            case RobotStatus::CHARGING:    return "CHARGING";
+            case RobotStatus::LOW_BATTERY: return "LOW_BATTERY";
+            case RobotStatus::DISCHARGED:  return "DISCHARGED";
+            case RobotStatus::UNKNOWN:
+            default:                       return "UNKNOWN";
+        }
+    }
+}
+
+#endif // ROBOT_MODELS_HPP
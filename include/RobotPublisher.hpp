@@ -2,14 +2,32 @@
 #define ROBOT_PUBLISHER_HPP
 
 #include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
 #include <fastdds/dds/publisher/Publisher.hpp>
 #include <fastdds/dds/publisher/DataWriter.hpp>
 #include <fastdds/dds/publisher/DataWriterListener.hpp>
 #include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
 #include <fastdds/dds/topic/Topic.hpp>
 
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "RobotTelemetry.hpp"
 #include "RobotTelemetryPubSubTypes.hpp"
+#include "RobotTelemetryPlain.hpp"
+#include "RobotTelemetryPlainPubSubTypes.hpp"
+#include "RobotTelemetryCompact.hpp"
+#include "RobotTelemetryCompactPubSubTypes.hpp"
+#include "RobotTelemetryDelta.hpp"
+#include "RobotTelemetryDeltaPubSubTypes.hpp"
+#include "RobotTelemetryBatch.hpp"
+#include "RobotTelemetryBatchPubSubTypes.hpp"
+#include "RobotTelemetryDeltaBatch.hpp"
+#include "RobotTelemetryDeltaBatchPubSubTypes.hpp"
+#include "TelemetryDeltaCodec.hpp"
 #include "PubListener.hpp"
 
 using namespace eprosima::fastdds::dds;
@@ -24,14 +42,89 @@ using namespace eprosima::fastdds::dds;
  class RobotPublisher
  {
 public:
+    // bound of RobotTelemetryBatch::samples
+    static const std::size_t kMaxBatchSamples = 256;
+    // one UDP datagram, no RTPS fragmentation
+    static const std::size_t kDefaultBatchBytes = 60000;
+    // bound of RobotTelemetryDeltaBatch::records
+    static const std::size_t kMaxDeltaBatchBytes = 65000;
+
     RobotPublisher();
     ~RobotPublisher();
 
     //bool init();
     bool init(const DataWriterQos& qos = DATAWRITER_QOS_DEFAULT);
+    bool init(const DataWriterQos& qos, const DomainParticipantQos& pqos);
+
+    // publish RobotTelemetryPlain on "robot_telemetry_plain" instead: the type is
+    // bounded and plain, so same-host readers can use data-sharing
+    bool initPlain(const DataWriterQos& qos, const DomainParticipantQos& pqos = PARTICIPANT_QOS_DEFAULT);
+    // publish RobotTelemetryCompact on "robot_telemetry_compact" instead: positions in mm,
+    // heading in 1/65536 turn, battery in %, ~40 % fewer bytes than RobotTelemetry.
+    // publish(RobotTelemetry&) and publishLoaned() quantize through TelemetryConversions.
+    bool initCompact(const DataWriterQos& qos, const DomainParticipantQos& pqos = PARTICIPANT_QOS_DEFAULT);
+    // publish RobotTelemetryDelta on "robot_telemetry_delta" instead: a keyframe per robot
+    // every keyframe_interval samples, varint deltas in between (TelemetryDeltaCodec.hpp).
+    // publish(RobotTelemetry&) and publishLoaned() encode; a newly matched reader
+    // gets a keyframe of every robot on its next sample.
+    bool initDelta(const DataWriterQos& qos,
+                   uint32_t keyframe_interval = TelemetryDeltaEncoder::kDefaultKeyframeInterval,
+                   const DomainParticipantQos& pqos = PARTICIPANT_QOS_DEFAULT);
+    // publish RobotTelemetryBatch on "robot_telemetry_batch" instead: publish() and
+    // publishLoaned() append a record to the current batch, which is written once it
+    // holds max_samples records or the next record would take it past max_bytes
+    // (XCDRv2 size of the records). Call flush() after the last robot of a tick.
+    bool initBatch(const DataWriterQos& qos,
+                   std::size_t max_samples = kMaxBatchSamples,
+                   std::size_t max_bytes = kDefaultBatchBytes,
+                   const DomainParticipantQos& pqos = PARTICIPANT_QOS_DEFAULT);
+    // both: publish RobotTelemetryDeltaBatch on "robot_telemetry_delta_batch". Each
+    // sample is encoded as in initDelta() and appended as a record (slot + frame,
+    // the id only in keyframes) to the current batch, written as in initBatch()
+    // with max_bytes counting the record bytes (at most kMaxDeltaBatchBytes).
+    bool initDeltaBatch(const DataWriterQos& qos,
+                        uint32_t keyframe_interval = TelemetryDeltaEncoder::kDefaultKeyframeInterval,
+                        std::size_t max_samples = kMaxBatchSamples,
+                        std::size_t max_bytes = kDefaultBatchBytes,
+                        const DomainParticipantQos& pqos = PARTICIPANT_QOS_DEFAULT);
+    // must be called before init: topic name instead of the default topic of the type
+    void setTopicName(const std::string& name) { topic_name_ = name; }
+    // must be called before init: RobotTelemetry through RobotTelemetryFastPubSubType
+    // (same wire format as the generated type support, fixed-layout serializer)
+    void setFastSerialization(bool enabled);
+    // must be called before init: spread the robots over `count` DataWriters of the
+    // topic, on the one participant and Publisher. A robot goes to the next writer,
+    // round-robin, on its first sample: count >= fleet size is one writer (and one
+    // history) per robot, 1 (default) the single keyed writer. initBatch() uses one.
+    // With more than one writer publishLoaned() fills a reused sample, no loans.
+    void setWriterCount(std::size_t count);
+    std::size_t getWriterCount() const { return writers_.size(); }
+    // writers with at least one matched reader
+    std::size_t getMatchedWriters() const;
+    // false: no console output on init / stop / matching, errors still go to
+    // std::cerr (e.g. many publishers in one process)
+    void setVerbose(bool verbose);
 
     bool publish(RobotTelemetry& data);
+    bool publish(RobotTelemetryPlain& data);
+    bool publish(RobotTelemetryCompact& data);
+
+    // zero-copy path: loan a sample from the writer, let `fill` write into it, write it.
+    // Types the writer can't loan fall back to one reused sample (no per-tick allocation).
+    bool publishLoaned(const std::function<void(RobotTelemetry&)>& fill);
+    // same for a writer created with initPlain(); with data-sharing the loan
+    // lives in the shared segment and the reader sees it without a copy
+    bool publishPlain(const std::function<void(RobotTelemetryPlain&)>& fill);
+    bool isPlain() const { return plain_; }
+    bool isCompact() const { return compact_; }
+    bool isDelta() const { return delta_encoder_ != nullptr; }
+    bool isBatch() const { return batch_; }
+    // batch mode: writes the records queued so far; true when there is nothing to write
+    bool flush();
     int getMatchedSubscribers() const;
+    // blocks until `count` subscribers are matched (woken by the listener, no
+    // polling); false after timeout_ms. Replaces a fixed sleep before the first sample.
+    bool waitForMatch(int timeout_ms, int count = 1);
     void printWriterQoS(const DataWriterQos& qos);
 
     void stop();
@@ -41,10 +134,67 @@ private:
     DomainParticipant* participant_;
     Publisher* publisher_;
     Topic* topic_;
+    // writers_[0]; the only writer unless setWriterCount() asked for more
     DataWriter* writer_;
+    std::vector<DataWriter*> writers_;
+    std::size_t writer_count_;
     TypeSupport type_;
     PubListener listener_;
 
-   
+    // true after initPlain(): the writer's type is RobotTelemetryPlain
+    bool plain_;
+    // true after initCompact(): the writer's type is RobotTelemetryCompact
+    bool compact_;
+    // set by initDelta(): the writer's type is RobotTelemetryDelta
+    // (RobotTelemetryDeltaBatch with batch_, initDeltaBatch())
+    std::unique_ptr<TelemetryDeltaEncoder> delta_encoder_;
+    // readers ever matched at the last delta publish, a new one triggers keyframes
+    int delta_matched_;
+    // true after initBatch(): the writer's type is RobotTelemetryBatch
+    bool batch_;
+    std::size_t batch_max_samples_;
+    std::size_t batch_max_bytes_;
+    // XCDRv2 size of the records in batch_sample_
+    std::size_t batch_bytes_;
+    RobotTelemetryBatch batch_sample_;
+    RobotTelemetryDeltaBatch delta_batch_sample_;
+    std::size_t delta_batch_records_;
+    // sizes the records against batch_max_bytes_
+    RobotTelemetryPubSubType record_type_;
+    // empty: the default topic of the type
+    std::string topic_name_;
+
+    // loan_sample() support, checked on the first loaned publish
+    bool loan_checked_;
+    bool loan_supported_;
+    RobotTelemetry reuse_sample_;
+    RobotTelemetryPlain reuse_plain_sample_;
+    RobotTelemetryCompact reuse_compact_sample_;
+    RobotTelemetryDelta reuse_delta_sample_;
+
+    struct Route
+    {
+        DataWriter* writer;
+        InstanceHandle_t handle;
+    };
+
+    // robot id -> its writer and instance handle, so write(data, handle) does not
+    // rehash the key every tick
+    std::unordered_map<std::string, Route> routes_;
+    // writer of the next new robot
+    std::size_t next_writer_;
+
+    bool verbose_;
+
+    const Route& route(const std::string& id, const void* sample);
+    bool publishDelta(const RobotTelemetry& data);
+    bool publishDeltaRecord(const RobotTelemetry& data);
+    bool publishBatched(const std::function<void(RobotTelemetry&)>& fill);
+    bool writeBatch();
+
+    bool createEntities(const std::string& topic_name, const DataWriterQos& qos, const DomainParticipantQos& pqos);
+
+    template<typename T>
+    bool publishLoanedSample(const std::function<void(T&)>& fill, T& reuse_sample);
  };
 #endif
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define ROBOT_SIMULATOR_HPP
 
 #include "RobotTelemetry.hpp"
+#include "RobotTelemetryPlain.hpp"
 #include <string>
 
 class RobotSimulator
@@ -21,6 +22,10 @@ public:
     void update(double dt);
 
     RobotTelemetry generateTelemetry();
+    // fill an existing sample in place (e.g. a DataWriter loan), no temporary copy
+    void fillTelemetry(RobotTelemetry& telemetry) const;
+    // bounded variant for data-sharing (id truncated to 15 characters)
+    void fillTelemetry(RobotTelemetryPlain& telemetry) const;
 
     void setCircularMotion(double radius, double angular_velocity);
     void setLinearMotion(double velocity, double angle);
@@ -63,7 +68,7 @@ private:
     void updateCircularMotion(double dt);
     void updateLinearMotion(double dt);
     void updateBattery(double dt);
-    std::string determineStatus() const;
+    RobotStatus determineStatus() const;
 
 
 };
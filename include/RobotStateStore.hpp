@@ -0,0 +1,84 @@
+#ifndef ROBOT_STATE_STORE_HPP
+#define ROBOT_STATE_STORE_HPP
+
+#include "RobotIndex.hpp"
+#include "RobotTelemetry.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Latest known state of every robot, shared between the ingest
+ * thread and any number of readers (dashboard, monitors)
+ *
+ * Memory is allocated once for max_robots: one fixed slot per robot plus a
+ * RobotIndex from id to slot. An update is a hash lookup and a
+ * seqlock-protected store into the robot's slot, so it
+ * costs the same with 10 or 100k robots. Readers never take a lock and
+ * never block the writer; they retry a slot if it changed while being copied.
+ *
+ * Robots are only added, never removed. Once max_robots ids are known, new
+ * ids are rejected and counted.
+ */
+class RobotStateStore
+{
+public:
+    static constexpr std::size_t kIdSize = RobotIndex::kIdSize;
+
+    struct RobotState
+    {
+        char id[kIdSize];
+        double x;
+        double y;
+        double orientation;
+        double speed;
+        uint64_t timestamp;          // publisher timestamp (ns)
+        float battery_level;
+        RobotStatus status;
+        int64_t source_timestamp;    // DDS source timestamp (ns), 0 if unknown
+        uint64_t updates;            // samples received for this robot
+    };
+
+    explicit RobotStateStore(std::size_t max_robots);
+
+    RobotStateStore(const RobotStateStore&) = delete;
+    RobotStateStore& operator=(const RobotStateStore&) = delete;
+
+    // ingest: false if the id is empty/too long or the store is full
+    bool update(const RobotTelemetry& telemetry, int64_t source_timestamp = 0);
+
+    // latest state of one robot, false if the id was never seen
+    bool get(const std::string& id, RobotState& state) const;
+
+    // copies every known robot into `states` (resized, so a reused vector
+    // does not allocate); each entry is consistent on its own
+    std::size_t snapshot(std::vector<RobotState>& states) const;
+
+    std::size_t size() const { return index_.size(); }
+    std::size_t capacity() const { return slots_.size(); }
+    uint64_t getRejected() const { return rejected_.load(std::memory_order_relaxed); }
+    // slots + index
+    std::size_t memoryBytes() const;
+
+private:
+    // the part of RobotState after the id, stored as 64-bit words
+    static constexpr std::size_t kValuesOffset = kIdSize;
+    static constexpr std::size_t kValueWords = (sizeof(RobotState) - kValuesOffset) / sizeof(uint64_t);
+
+    struct Slot
+    {
+        std::atomic<uint32_t> sequence;              // odd while being written
+        std::atomic<uint64_t> values[kValueWords];
+    };
+
+    RobotIndex index_;                               // robot number = slot
+    std::vector<Slot> slots_;
+    std::atomic<uint64_t> rejected_;
+
+    void write(Slot& slot, const RobotTelemetry& telemetry, int64_t source_timestamp);
+    void read(std::size_t robot, RobotState& state) const;
+};
+
+#endif // ROBOT_STATE_STORE_HPP
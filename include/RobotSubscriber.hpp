@@ -1,7 +1,12 @@
 #ifndef ROBOT_SUBSCRIBER_HPP
 #define ROBOT_SUBSCRIBER_HPP
 
+#include <fastdds/dds/core/LoanableSequence.hpp>
+#include <fastdds/dds/core/condition/GuardCondition.hpp>
+#include <fastdds/dds/core/condition/StatusCondition.hpp>
+#include <fastdds/dds/core/condition/WaitSet.hpp>
 #include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
 #include <fastdds/dds/subscriber/Subscriber.hpp>
 #include <fastdds/dds/subscriber/DataReader.hpp>
 #include <fastdds/dds/subscriber/DataReaderListener.hpp>
@@ -10,18 +15,87 @@
 #include <fastdds/dds/topic/Topic.hpp>
 
 #include "SubListener.hpp"
+#include "RobotStateStore.hpp"
+#include "TelemetryHistory.hpp"
+#include "TelemetryRecorder.hpp"
+#include "LatencyTracker.hpp"
 #include "RobotTelemetry.hpp"
 #include "RobotTelemetryPubSubTypes.hpp"
+#include "RobotTelemetryPlainPubSubTypes.hpp"
+#include "RobotTelemetryCompactPubSubTypes.hpp"
+#include "RobotTelemetryDeltaPubSubTypes.hpp"
+#include "RobotTelemetryBatchPubSubTypes.hpp"
+#include "RobotTelemetryDeltaBatchPubSubTypes.hpp"
+#include "TelemetryDeltaCodec.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
 
 using namespace eprosima::fastdds::dds;
 
 class RobotSubscriber
 {
 public:
+    enum class ReadMode
+    {
+        LISTENER,   // take_next_sample() in on_data_available (DDS event thread)
+        WAITSET     // own thread: WaitSet + batched take() into loaned sequences
+    };
+
     RobotSubscriber();
     ~RobotSubscriber();
 
     bool init(DataReaderQos& qos);
+    bool init(const DataReaderQos& qos, const DomainParticipantQos& pqos);
+    // read RobotTelemetryPlain from "robot_telemetry_plain" (data-sharing capable)
+    bool initPlain(const DataReaderQos& qos, const DomainParticipantQos& pqos = PARTICIPANT_QOS_DEFAULT);
+    // read RobotTelemetryCompact from "robot_telemetry_compact", decoded with
+    // TelemetryConversions::fromCompact before any consumer sees it
+    bool initCompact(const DataReaderQos& qos, const DomainParticipantQos& pqos = PARTICIPANT_QOS_DEFAULT);
+    // read RobotTelemetryDelta from "robot_telemetry_delta" and rebuild full samples;
+    // each robot is delivered from its first keyframe on
+    bool initDelta(const DataReaderQos& qos, const DomainParticipantQos& pqos = PARTICIPANT_QOS_DEFAULT);
+    // read RobotTelemetryBatch from "robot_telemetry_batch"; each record goes through
+    // the per-robot path (state store, history, callback...) with the batch's SampleInfo
+    bool initBatch(const DataReaderQos& qos, const DomainParticipantQos& pqos = PARTICIPANT_QOS_DEFAULT);
+    // both: read RobotTelemetryDeltaBatch from "robot_telemetry_delta_batch" and
+    // rebuild every record as in initDelta()
+    bool initDeltaBatch(const DataReaderQos& qos, const DomainParticipantQos& pqos = PARTICIPANT_QOS_DEFAULT);
+    // nullptr unless initDelta() or initDeltaBatch() was called; read it after stop()
+    const TelemetryDeltaDecoder* getDeltaDecoder() const { return delta_decoder_.get(); }
+    // must be called before init: topic name instead of the default topic of the type
+    void setTopicName(const std::string& name) { topic_name_ = name; }
+    // must be called before init: RobotTelemetry through RobotTelemetryFastPubSubType
+    // (same wire format as the generated type support, fixed-layout deserializer)
+    void setFastSerialization(bool enabled);
+    // must be set before init, samples are then not printed
+    void setSampleCallback(const SubListener::SampleCallback& callback) { listener_.setSampleCallback(callback); }
+    // must be set before init; max_batch = samples per take() in WAITSET mode
+    void setReadMode(ReadMode mode, int32_t max_batch = 256) { read_mode_ = mode; max_batch_ = max_batch; }
+    ReadMode getReadMode() const { return read_mode_; }
+    // WAITSET mode: the reader thread is alive (it only exits in stop())
+    bool isReaderRunning() const { return reader_running_.load(); }
+    // WAITSET mode: failed wait() / take() calls, each retried after a short pause
+    uint64_t getReadErrors() const { return read_errors_.load(); }
+    // must be called before init: keep the latest state of up to max_robots robots
+    void enableStateStore(std::size_t max_robots);
+    // nullptr unless enableStateStore() was called; safe to read from any thread
+    const RobotStateStore* getStateStore() const { return state_store_.get(); }
+    // must be called before init: keep raw samples and roll-ups per robot
+    void enableHistory(const TelemetryHistory::Config& config);
+    // nullptr unless enableHistory() was called; safe to query from any thread
+    const TelemetryHistory* getHistory() const { return history_.get(); }
+    // must be called before init: record every sample to config.directory
+    // (closed in stop()); false if the first segment cannot be created
+    bool enableRecorder(const TelemetryRecorder::Config& config);
+    const TelemetryRecorder* getRecorder() const { return recorder_.get(); }
+    // must be called before init: latency histograms labelled with the QoS
+    // profile, printed every report_interval_ms (0 = only on stop())
+    void enableLatencyTracking(const std::string& profile, std::size_t max_robots, int report_interval_ms = 5000);
+    const LatencyTracker* getLatencyTracker() const { return latency_.get(); }
     void printReaderQoS(const DataReaderQos& qos);
     void run();
     int getMatchedPublishers() const;
@@ -35,6 +109,31 @@ private:
     DataReader* reader_;
     TypeSupport type_;
     SubListener listener_;
+    std::unique_ptr<RobotStateStore> state_store_;
+    std::unique_ptr<TelemetryHistory> history_;
+    std::unique_ptr<TelemetryRecorder> recorder_;
+    std::unique_ptr<LatencyTracker> latency_;
+    std::unique_ptr<TelemetryDeltaDecoder> delta_decoder_;
+    // empty: the default topic of the type
+    std::string topic_name_;
+
+    // WAITSET mode
+    ReadMode read_mode_;
+    int32_t max_batch_;
+    bool plain_;
+    bool compact_;
+    bool batch_;
+    std::thread reader_thread_;
+    GuardCondition stop_condition_;
+    std::atomic<bool> reader_running_;
+    std::atomic<uint64_t> read_errors_;
+
+    bool createEntities(const std::string& topic_name, const DataReaderQos& qos, const DomainParticipantQos& pqos);
+    void readerLoop();
+    // take() batches until the reader is empty, returns false on a read error
+    // (the caller counts it and retries)
+    template<typename T>
+    bool drainReader();
 };
 
 #endif
\ No newline at end of file
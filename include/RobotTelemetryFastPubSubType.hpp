@@ -0,0 +1,60 @@
+#ifndef ROBOT_TELEMETRY_FAST_PUBSUB_TYPE_HPP
+#define ROBOT_TELEMETRY_FAST_PUBSUB_TYPE_HPP
+
+#include "RobotTelemetry.hpp"
+#include "RobotTelemetryPubSubTypes.hpp"
+#include <fastdds/utils/md5.hpp>
+#include <cstdint>
+
+/**
+ * @brief RobotTelemetry type support with a fixed-layout fast path
+ *
+ * Produces the same bytes as the generated RobotTelemetryPubSubType, so it
+ * interoperates with stock readers and writers (same type name, same wire
+ * format, same instance handles). The only variable-size member is the id:
+ * everything after it is a fixed block at a known offset, written and read
+ * with a single memcpy instead of going through Fast CDR member by member.
+ *
+ * The fast path covers little-endian hosts, XCDRv1 (PLAIN_CDR) and XCDRv2
+ * (DELIMIT_CDR2) and ids up to kMaxFastIdLength characters. Anything else
+ * (big-endian payloads, longer ids, payloads from a future appendable
+ * version) goes through the generated code.
+ */
+class RobotTelemetryFastPubSubType : public RobotTelemetryPubSubType
+{
+public:
+    // the bound fastddsgen uses for unbounded strings in max_serialized_type_size
+    static const uint32_t kMaxFastIdLength = 255;
+
+    RobotTelemetryFastPubSubType();
+
+    bool serialize(
+            const void* const data,
+            eprosima::fastdds::rtps::SerializedPayload_t& payload,
+            eprosima::fastdds::dds::DataRepresentationId_t data_representation) override;
+
+    bool deserialize(
+            eprosima::fastdds::rtps::SerializedPayload_t& payload,
+            void* data) override;
+
+    uint32_t calculate_serialized_size(
+            const void* const data,
+            eprosima::fastdds::dds::DataRepresentationId_t data_representation) override;
+
+    bool compute_key(
+            eprosima::fastdds::rtps::SerializedPayload_t& payload,
+            eprosima::fastdds::rtps::InstanceHandle_t& ihandle,
+            bool force_md5 = false) override;
+
+    bool compute_key(
+            const void* const data,
+            eprosima::fastdds::rtps::InstanceHandle_t& ihandle,
+            bool force_md5 = false) override;
+
+private:
+    eprosima::fastdds::MD5 key_md5_;
+
+    void hashKey(const char* id, uint32_t length, eprosima::fastdds::rtps::InstanceHandle_t& ihandle);
+};
+
+#endif // ROBOT_TELEMETRY_FAST_PUBSUB_TYPE_HPP
@@ -0,0 +1,73 @@
+#ifndef SIMD_KERNELS_HPP
+#define SIMD_KERNELS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Batch kernels used by FleetSimulator::update
+ *
+ * Every kernel has a scalar version (a loop over the RobotModels functions,
+ * i.e. exactly what RobotSimulator computes) and an AVX2 version. The AVX2
+ * one is built on x86 (ROBOT_SIMD_AVX2) and only used when the CPU
+ * supports AVX2 + FMA, detected at runtime.
+ *
+ * Tolerance of the AVX2 kernels against the scalar ones:
+ *  - circularPhase: cos/sin within kSinCosTolerance (absolute) and the
+ *    wrapped heading within orientationTolerance(angle), for
+ *    |angle| <= kMaxVectorAngle. Larger angles fall back to the scalar code.
+ *    The scalar heading wraps by repeated subtraction of 2*pi, the vector one
+ *    with a single floor(), so the two drift apart by ~1 ulp per wrap.
+ *  - batteryStep: bit-identical (same IEEE operations, no FMA contraction).
+ */
+namespace SimdKernels
+{
+    enum class Isa
+    {
+        SCALAR,
+        AVX2
+    };
+
+    constexpr double kSinCosTolerance = 1e-15;
+    constexpr double kOrientationTolerancePerRad = 4e-12;
+    constexpr double kMaxVectorAngle = 1e6;
+
+    // allowed heading difference (rad) between the kernels for a given angle
+    inline double orientationTolerance(double angle)
+    {
+        return kOrientationTolerancePerRad * (1.0 + (angle < 0 ? -angle : angle));
+    }
+
+    // best instruction set supported by the running CPU
+    Isa detectIsa();
+    const char* isaName(Isa isa);
+
+    // for each i: angle = angular_velocity[i] * time
+    // cos_out/sin_out = cos/sin(angle), orientation_out = angle + pi/2 wrapped into [0, 2pi]
+    void circularPhase(Isa isa, std::size_t count,
+                       const double* angular_velocity, double time,
+                       double* cos_out, double* sin_out, double* orientation_out);
+
+    // RobotModels::batteryStep for every robot in [0, count)
+    // moving[i] != 0: not stationary with a positive velocity
+    void batteryStep(Isa isa, std::size_t count, double dt, const uint8_t* moving,
+                     const float* drain_rate, const float* charge_rate,
+                     float* level, uint8_t* charging);
+
+    namespace detail
+    {
+        // AVX2 implementations, defined in SimdKernelsAvx2.cpp (compiled with -mavx2 -mfma)
+        // the tail (count % 4, count % 8 for batteryStep) goes through the same vector
+        // code via a padded block, so a robot's result doesn't depend on where a range
+        // starts or ends
+        void circularPhaseAvx2(std::size_t count,
+                               const double* angular_velocity, double time,
+                               double* cos_out, double* sin_out, double* orientation_out);
+
+        void batteryStepAvx2(std::size_t count, double dt, const uint8_t* moving,
+                             const float* drain_rate, const float* charge_rate,
+                             float* level, uint8_t* charging);
+    }
+}
+
+#endif // SIMD_KERNELS_HPP
@@ -6,21 +6,47 @@
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <fastdds/dds/topic/Topic.hpp>
+#include <atomic>
+#include <functional>
 #include <iostream>
 #include <iomanip>
 #include <string>
 
 #include "RobotTelemetry.hpp"
 #include "RobotTelemetryPubSubTypes.hpp"
+#include "RobotTelemetryPlain.hpp"
+#include "RobotTelemetryCompact.hpp"
+#include "RobotTelemetryDelta.hpp"
+#include "RobotTelemetryBatch.hpp"
+#include "RobotTelemetryDeltaBatch.hpp"
+#include "TelemetryDeltaCodec.hpp"
+#include "AsyncLogger.hpp"
+#include "TelemetryLog.hpp"
+#include "TelemetryConversions.hpp"
+#include "RobotStateStore.hpp"
+#include "TelemetryHistory.hpp"
+#include "TelemetryRecorder.hpp"
+#include "LatencyTracker.hpp"
 
 using namespace eprosima::fastdds::dds;  
 
 class SubListener : public DataReaderListener
 {
 public:
+    // replaces the console print for each valid sample (runs on the listener thread)
+    using SampleCallback = std::function<void(const RobotTelemetry&, const SampleInfo&)>;
+
     SubListener() 
         : matched_(0)
         , samples_received_(0)
+        , plain_(false)
+        , compact_(false)
+        , batch_(false)
+        , state_store_(nullptr)
+        , history_(nullptr)
+        , recorder_(nullptr)
+        , latency_(nullptr)
+        , delta_decoder_(nullptr)
     {}
     
     ~SubListener() override {}
@@ -32,53 +58,167 @@ public:
         if (info.current_count_change == 1)
         {
             matched_ = info.current_count;
-            std::cout << "[Subscriber Listener] Publisher connected! Total: " << matched_ << std::endl;
+            std::cout << "[Subscriber Listener] Publisher connected! Total: " << matched_.load() << std::endl;
         }
         else if (info.current_count_change == -1)
         {
             matched_ = info.current_count;
-            std::cout << "[Subscriber Listener] Publisher disconnected! Total: " << matched_ << std::endl;  // Corectat mesaj
+            std::cout << "[Subscriber Listener] Publisher disconnected! Total: " << matched_.load() << std::endl;  // Corectat mesaj
+        }
+    }
+
+    // the reader's type is RobotTelemetryPlain (RobotSubscriber::initPlain)
+    void setPlain(bool plain) { plain_ = plain; }
+    // the reader's type is RobotTelemetryCompact (RobotSubscriber::initCompact)
+    void setCompact(bool compact) { compact_ = compact; }
+    // the reader's type is RobotTelemetryBatch (RobotSubscriber::initBatch), or
+    // RobotTelemetryDeltaBatch with a delta decoder (RobotSubscriber::initDeltaBatch)
+    void setBatch(bool batch) { batch_ = batch; }
+    void setSampleCallback(const SampleCallback& callback) { callback_ = callback; }
+    // latest state per robot, updated before the callback / log (not owned)
+    void setStateStore(RobotStateStore* store) { state_store_ = store; }
+    // per-robot history and roll-ups, appended with the state store (not owned)
+    void setHistory(TelemetryHistory* history) { history_ = history; }
+    // appends every valid sample to segment files (not owned)
+    void setRecorder(TelemetryRecorder* recorder) { recorder_ = recorder; }
+    // publish -> receive latency per robot (not owned)
+    void setLatencyTracker(LatencyTracker* latency) { latency_ = latency; }
+    // the reader's type is RobotTelemetryDelta, frames are rebuilt with it (not owned)
+    void setDeltaDecoder(TelemetryDeltaDecoder* decoder) { delta_decoder_ = decoder; }
+
+    // counts a valid sample and hands it to the callback (or logs it);
+    // also used by RobotSubscriber's WaitSet reader thread
+    void handleSample(const RobotTelemetry& telemetry, const SampleInfo& info)
+    {
+        uint32_t count = ++samples_received_;
+
+        // first, before the other consumers add to the measured time
+        if (latency_ != nullptr)
+            latency_->record(telemetry);
+        if (state_store_ != nullptr)
+            state_store_->update(telemetry, info.source_timestamp.to_ns());
+        if (history_ != nullptr)
+            history_->append(telemetry);
+        if (recorder_ != nullptr)
+            recorder_->record(telemetry);
+
+        if (callback_)
+        {
+            callback_(telemetry, info);
+            return;
         }
+
+        // formatted and written by the logger thread, 1 in N per robot
+        AsyncLogger& logger = AsyncLogger::instance();
+        if (logger.sample(AsyncLogger::Category::TELEMETRY, telemetry.id()))
+            logger.log(AsyncLogger::Category::TELEMETRY, &TelemetryLog::formatReceived,
+                       TelemetryLog::makeRecord(telemetry, count));
+    }
+
+    // every record of a batch goes through handleSample, with the batch's SampleInfo
+    void handleBatch(const RobotTelemetryBatch& batch, const SampleInfo& info)
+    {
+        for (const RobotTelemetry& telemetry : batch.samples())
+            handleSample(telemetry, info);
+    }
+
+    // the records of a delta batch are rebuilt per writer, each through handleSample
+    void handleDeltaBatch(const RobotTelemetryDeltaBatch& batch, const SampleInfo& info)
+    {
+        // the writer's GUID: the record slots are numbered per writer
+        std::string writer(16, '\0');
+        for (std::size_t i = 0; i < writer.size(); i++)
+            writer[i] = static_cast<char>(info.publication_handle.value[i]);
+
+        delta_decoder_->decodeRecords(writer, batch.records(), [this, &info](const RobotTelemetry& telemetry)
+        {
+            handleSample(telemetry, info);
+        });
     }
 
     void on_data_available(DataReader* reader)
     {
         RobotTelemetry telemetry;
         SampleInfo info;
+        ReturnCode_t ret;
+        // false for a delta frame that cannot be rebuilt yet
+        bool decoded = true;
 
-        ReturnCode_t ret = reader->take_next_sample(&telemetry, &info);
+        if (delta_decoder_ != nullptr && batch_)
+        {
+            RobotTelemetryDeltaBatch batch;
+            ret = reader->take_next_sample(&batch, &info);
+            if (ret == RETCODE_OK && info.valid_data)
+                handleDeltaBatch(batch, info);
+            // the records were delivered above
+            decoded = false;
+        }
+        else if (delta_decoder_ != nullptr)
+        {
+            RobotTelemetryDelta delta;
+            ret = reader->take_next_sample(&delta, &info);
+            if (ret == RETCODE_OK && info.valid_data)
+                decoded = delta_decoder_->decode(delta.id(), delta.frame(), telemetry);
+        }
+        else if (plain_)
+        {
+            RobotTelemetryPlain plain;
+            ret = reader->take_next_sample(&plain, &info);
+            if (ret == RETCODE_OK && info.valid_data)
+                TelemetryConversions::fromPlain(plain, telemetry);
+        }
+        else if (compact_)
+        {
+            RobotTelemetryCompact compact;
+            ret = reader->take_next_sample(&compact, &info);
+            if (ret == RETCODE_OK && info.valid_data)
+                TelemetryConversions::fromCompact(compact, telemetry);
+        }
+        else if (batch_)
+        {
+            RobotTelemetryBatch batch;
+            ret = reader->take_next_sample(&batch, &info);
+            if (ret == RETCODE_OK && info.valid_data)
+                handleBatch(batch, info);
+            // the records were delivered above
+            decoded = false;
+        }
+        else
+        {
+            ret = reader->take_next_sample(&telemetry, &info);
+        }
 
         if (ret == RETCODE_OK)
         {
-            if (info.valid_data)
-            {
-                samples_received_++;
-
-                std::cout << "\n[Subscriber] Mesaj #" << samples_received_ << " primit:" << std::endl;
-                std::cout << "  Robot ID:    " << telemetry.id() << std::endl;
-                std::cout << "  Poziție:     (" << std::fixed << std::setprecision(2) 
-                        << telemetry.x() << ", " << telemetry.y() << ") m" << std::endl;
-                std::cout << "  Orientare:   " << telemetry.orientation() << " rad" << std::endl;
-                std::cout << "  Baterie:     " << telemetry.battery_level() << "%" << std::endl;
-                std::cout << "  Viteză:      " << telemetry.speed() << " m/s" << std::endl;
-                std::cout << "  Status:      " << telemetry.status() << std::endl;
-                std::cout << "  Timestamp:   " << telemetry.timestamp() << " ns" << std::endl;
-                std::cout << std::string(50, '-') << std::endl;
-            }
+            if (info.valid_data && decoded)
+                handleSample(telemetry, info);
         }
         else if (ret == RETCODE_NO_DATA)
         {
-            std::cout << "[Subscriber] on_data_available apelat dar nu există date!" << std::endl;
+            AsyncLogger::instance().text(AsyncLogger::Category::SUBSCRIBER,
+                                         "[Subscriber] on_data_available apelat dar nu există date!");
         }
         else
         {
-            std::cerr << "[Subscriber] Eroare la citirea datelor! ReturnCode: " << ret << std::endl;
+            AsyncLogger::instance().text(AsyncLogger::Category::SUBSCRIBER,
+                                         "[Subscriber] Eroare la citirea datelor! ReturnCode: " + std::to_string(ret));
         }
     }
 
    
-    int matched_;                // num of publishers connected
-    uint32_t samples_received_;  // num of messages received
+    std::atomic<int> matched_;   // num of publishers connected
+    std::atomic<uint32_t> samples_received_;  // num of messages received
+
+private:
+    bool plain_;
+    bool compact_;
+    bool batch_;
+    SampleCallback callback_;
+    RobotStateStore* state_store_;
+    TelemetryHistory* history_;
+    TelemetryRecorder* recorder_;
+    LatencyTracker* latency_;
+    TelemetryDeltaDecoder* delta_decoder_;
 
 };
 
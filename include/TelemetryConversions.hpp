@@ -0,0 +1,121 @@
+#ifndef TELEMETRY_CONVERSIONS_HPP
+#define TELEMETRY_CONVERSIONS_HPP
+
+#include "RobotStatus.hpp"
+#include "RobotTelemetry.hpp"
+#include "RobotTelemetryCompact.hpp"
+#include "RobotTelemetryPlain.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+
+/**
+ * @brief Conversions between RobotTelemetry and the bounded RobotTelemetryPlain
+ * or the quantized RobotTelemetryCompact
+ *
+ * The plain id holds at most 15 characters plus the terminating '\0';
+ * longer ids are truncated.
+ *
+ * toCompact rounds to the nearest step of each compact field (1 mm, 1/65536
+ * turn, 1 mm/s, 1 %) and saturates out-of-range values. fromCompact is exact,
+ * so a compact sample survives fromCompact -> toCompact unchanged: whatever
+ * goes through the compact topic is decoded back to the same values on every
+ * reader. id, status and timestamp are carried as they are.
+ */
+namespace TelemetryConversions
+{
+    inline void setPlainId(RobotTelemetryPlain& plain, const std::string& id)
+    {
+        std::size_t length = std::min(id.size(), plain.id().size() - 1);
+        std::memcpy(plain.id().data(), id.data(), length);
+        std::memset(plain.id().data() + length, 0, plain.id().size() - length);
+    }
+
+    inline std::string plainId(const RobotTelemetryPlain& plain)
+    {
+        const char* begin = plain.id().data();
+        return std::string(begin, strnlen(begin, plain.id().size()));
+    }
+
+    inline void toPlain(const RobotTelemetry& telemetry, RobotTelemetryPlain& plain)
+    {
+        setPlainId(plain, telemetry.id());
+        plain.x(telemetry.x());
+        plain.y(telemetry.y());
+        plain.orientation(telemetry.orientation());
+        plain.speed(telemetry.speed());
+        plain.timestamp(telemetry.timestamp());
+        plain.battery_level(telemetry.battery_level());
+        plain.status(telemetry.status());
+    }
+
+    inline void fromPlain(const RobotTelemetryPlain& plain, RobotTelemetry& telemetry)
+    {
+        telemetry.id(plainId(plain));
+        telemetry.x(plain.x());
+        telemetry.y(plain.y());
+        telemetry.orientation(plain.orientation());
+        telemetry.speed(plain.speed());
+        telemetry.timestamp(plain.timestamp());
+        telemetry.battery_level(plain.battery_level());
+        telemetry.status(plain.status());
+    }
+
+    // compact field steps
+    const double kCompactMetre = 1000.0;                       // units per metre
+    const double kCompactTurn = 65536.0;                       // units per turn
+    const double kCompactRadian = kCompactTurn / (2.0 * M_PI); // units per radian
+
+    // round to the nearest unit, saturating to the range of T (NaN -> 0)
+    template<typename T>
+    inline T quantize(double value)
+    {
+        if (std::isnan(value))
+            return 0;
+
+        double rounded = std::round(value);
+        rounded = std::max(rounded, static_cast<double>(std::numeric_limits<T>::min()));
+        rounded = std::min(rounded, static_cast<double>(std::numeric_limits<T>::max()));
+        return static_cast<T>(rounded);
+    }
+
+    // any angle to [0, 65536) units, 2*pi wraps to 0
+    inline uint16_t quantizeAngle(double radians)
+    {
+        if (!std::isfinite(radians))
+            return 0;
+
+        double turns = radians / (2.0 * M_PI);
+        turns -= std::floor(turns);
+        return static_cast<uint16_t>(static_cast<uint32_t>(std::lround(turns * kCompactTurn)) & 0xFFFFu);
+    }
+
+    inline void toCompact(const RobotTelemetry& telemetry, RobotTelemetryCompact& compact)
+    {
+        compact.id(telemetry.id());
+        compact.x_mm(quantize<int32_t>(telemetry.x() * kCompactMetre));
+        compact.y_mm(quantize<int32_t>(telemetry.y() * kCompactMetre));
+        compact.status(telemetry.status());
+        compact.timestamp(telemetry.timestamp());
+        compact.orientation(quantizeAngle(telemetry.orientation()));
+        compact.speed_mm_s(quantize<int16_t>(telemetry.speed() * kCompactMetre));
+        compact.battery_percent(std::min(quantize<uint8_t>(telemetry.battery_level()), static_cast<uint8_t>(100)));
+    }
+
+    inline void fromCompact(const RobotTelemetryCompact& compact, RobotTelemetry& telemetry)
+    {
+        telemetry.id(compact.id());
+        telemetry.x(compact.x_mm() / kCompactMetre);
+        telemetry.y(compact.y_mm() / kCompactMetre);
+        telemetry.status(compact.status());
+        telemetry.timestamp(compact.timestamp());
+        telemetry.orientation(compact.orientation() / kCompactRadian);
+        telemetry.speed(compact.speed_mm_s() / kCompactMetre);
+        telemetry.battery_level(static_cast<float>(compact.battery_percent()));
+    }
+}
+
+#endif // TELEMETRY_CONVERSIONS_HPP
@@ -0,0 +1,135 @@
+#ifndef TELEMETRY_DELTA_CODEC_HPP
+#define TELEMETRY_DELTA_CODEC_HPP
+
+#include "RobotTelemetry.hpp"
+#include "RobotTelemetryCompact.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Delta/keyframe encoding of per-robot RobotTelemetry streams
+ *
+ * Samples are quantized exactly like RobotTelemetryCompact (mm, 1/65536 turn,
+ * mm/s, %; id, status and timestamp exact), so both sides keep the same
+ * integer state and the deltas never drift: a decoded sample equals
+ * fromCompact(toCompact(original)).
+ *
+ * Each robot is a stream of frames, one per sample:
+ *   [K|seq:15] 2 bytes, K = keyframe, seq = frame number mod 32768
+ *   keyframe:  every field, zig-zag varint
+ *   delta:     [mask] + zig-zag varint residual of each field set in mask
+ * The residual is the value minus a prediction: last value plus last step for
+ * timestamp, position and heading (a robot on a steady course or a steady
+ * tick leaves residuals of a few units), last value for speed, battery and
+ * status (nearly constant, so usually left out of the mask).
+ *
+ * A keyframe is sent every keyframe_interval frames of a robot. A decoder
+ * that joins late, or sees a seq gap, drops that robot's deltas until its
+ * next keyframe.
+ *
+ * Batched (RobotTelemetryDeltaBatch), the frames of many robots are packed
+ * back to back as records, without the per-sample id key:
+ *   [slot varint][K|seq:15][id length varint + id, keyframes only][frame body]
+ * The slot numbers the writer's robots in order of first sample; a keyframe
+ * (re)binds its slot to the id, so deltas only pay the slot (1-3 bytes).
+ */
+
+// per-robot state, the same on both sides
+struct TelemetryDeltaStream
+{
+    enum Field { TIMESTAMP, X, Y, ORIENTATION, SPEED, BATTERY, STATUS, FIELD_COUNT };
+
+    uint64_t last[FIELD_COUNT];
+    uint64_t previous[FIELD_COUNT];
+    uint16_t sequence = 0;
+    // encoder: frames since the last keyframe; decoder: unused
+    uint32_t since_keyframe = 0;
+    // encoder: batch record slot of the robot; decoder: unused
+    uint32_t slot = 0;
+    // decoder: a keyframe was received and no frame was missed since
+    bool synced = false;
+};
+
+class TelemetryDeltaEncoder
+{
+public:
+    // bound of RobotTelemetryDelta::frame; the largest frame is 36 bytes
+    static const std::size_t kMaxFrameSize = 64;
+    // 2 s at the 10 Hz publish rate
+    static const uint32_t kDefaultKeyframeInterval = 20;
+    // batch records: slots per writer, and the longest id (the RobotTelemetry key bound)
+    static const uint32_t kMaxStreams = 1u << 18;
+    static const std::size_t kMaxIdSize = 255;
+
+    explicit TelemetryDeltaEncoder(uint32_t keyframe_interval = kDefaultKeyframeInterval);
+
+    // replaces `frame` with the next frame of telemetry.id(), true for a keyframe
+    bool encode(const RobotTelemetry& telemetry, std::vector<uint8_t>& frame);
+    // appends the next frame of telemetry.id() to `records` as a batch record,
+    // true for a keyframe
+    bool encodeRecord(const RobotTelemetry& telemetry, std::vector<uint8_t>& records);
+    // the next frame of every robot is a keyframe (e.g. a reader just matched)
+    void requestKeyframes();
+
+    uint32_t getKeyframeInterval() const { return keyframe_interval_; }
+
+private:
+    uint32_t keyframe_interval_;
+    std::unordered_map<std::string, TelemetryDeltaStream> streams_;
+    RobotTelemetryCompact quantized_;
+
+    bool append(const RobotTelemetry& telemetry, bool record, std::vector<uint8_t>& out);
+};
+
+class TelemetryDeltaDecoder
+{
+public:
+    TelemetryDeltaDecoder();
+
+    // rebuilds the sample carried by `frame`; false when there is nothing to
+    // deliver: a delta before the robot's first keyframe or after a gap, or a
+    // malformed frame
+    bool decode(const std::string& id, const std::vector<uint8_t>& frame, RobotTelemetry& telemetry);
+    // rebuilds the records of one RobotTelemetryDeltaBatch; `writer` identifies the
+    // publishing DataWriter (slots are numbered per writer). `deliver` gets every
+    // sample that could be rebuilt. False on a malformed record: the rest of the
+    // batch is dropped, its robots resync at their next keyframe.
+    bool decodeRecords(const std::string& writer, const std::vector<uint8_t>& records,
+                       const std::function<void(const RobotTelemetry&)>& deliver);
+
+    uint64_t getKeyframes() const { return keyframes_; }
+    uint64_t getDeltas() const { return deltas_; }
+    // deltas dropped while waiting for a keyframe
+    uint64_t getSkipped() const { return skipped_; }
+    // seq gaps seen on synced streams (lost or reordered frames)
+    uint64_t getGaps() const { return gaps_; }
+    uint64_t getMalformed() const { return malformed_; }
+
+private:
+    struct RecordStream
+    {
+        std::string id;
+        TelemetryDeltaStream stream;
+    };
+
+    std::unordered_map<std::string, TelemetryDeltaStream> streams_;
+    // batch records: writer -> streams by slot
+    std::unordered_map<std::string, std::vector<RecordStream>> writers_;
+    RobotTelemetryCompact quantized_;
+    RobotTelemetry record_sample_;
+
+    uint64_t keyframes_;
+    uint64_t deltas_;
+    uint64_t skipped_;
+    uint64_t gaps_;
+    uint64_t malformed_;
+
+    bool apply(TelemetryDeltaStream* stream, bool keyframe, uint16_t sequence, const uint64_t* values, uint64_t* fields);
+    void rebuild(const uint64_t* fields, const std::string& id, RobotTelemetry& telemetry);
+};
+
+#endif // TELEMETRY_DELTA_CODEC_HPP
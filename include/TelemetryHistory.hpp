@@ -0,0 +1,215 @@
+#ifndef TELEMETRY_HISTORY_HPP
+#define TELEMETRY_HISTORY_HPP
+
+#include "RobotIndex.hpp"
+#include "RobotTelemetry.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/**
+ * @brief Recent telemetry history per robot: raw samples plus 1 s / 10 s /
+ * 1 min roll-ups (min, max, mean of x, y, battery and speed)
+ *
+ * Every series is a fixed-capacity ring per robot, stored column by column
+ * (one array per field for the whole fleet), so memory is
+ * max_robots * bytesPerRobot(config) and is allocated once. Pages of robots
+ * that never report are not touched. Roll-ups are updated as each sample
+ * arrives; when the ring of a tier is full the oldest bucket is overwritten.
+ *
+ * Range queries hand out pointers into the rings (at most two segments,
+ * because of the wrap-around) while holding the robot's lock, so nothing is
+ * copied. The callback must not keep the pointers.
+ */
+class TelemetryHistory
+{
+public:
+    enum class Metric : uint8_t
+    {
+        X,
+        Y,
+        BATTERY,
+        SPEED,
+        COUNT
+    };
+
+    enum class Tier : uint8_t
+    {
+        SECOND,
+        TEN_SECONDS,
+        MINUTE,
+        COUNT
+    };
+
+    static const std::size_t kMetrics = static_cast<std::size_t>(Metric::COUNT);
+    static const std::size_t kTiers = static_cast<std::size_t>(Tier::COUNT);
+
+    struct Config
+    {
+        std::size_t max_robots;
+        std::size_t raw_capacity;                // samples per robot at full rate
+        std::size_t tier_capacity[kTiers];       // buckets per robot for each tier
+    };
+
+    // 600 raw samples (1 min at 10 Hz), 5 min of 1 s, 1 h of 10 s and 1 h of 1 min buckets
+    static Config defaultConfig(std::size_t max_robots);
+
+    // contiguous run of raw samples, oldest first
+    struct RawSegment
+    {
+        std::size_t count;
+        const uint64_t* timestamp;               // publisher timestamp (ns)
+        const float* values[kMetrics];           // indexed by Metric
+    };
+
+    // contiguous run of roll-up buckets, oldest first
+    struct RollupSegment
+    {
+        std::size_t count;
+        const uint64_t* start;                   // bucket start (ns, multiple of the tier width)
+        const uint32_t* samples;                 // samples in the bucket
+        const float* min[kMetrics];
+        const float* max[kMetrics];
+        const float* mean[kMetrics];
+    };
+
+    explicit TelemetryHistory(const Config& config);
+
+    TelemetryHistory(const TelemetryHistory&) = delete;
+    TelemetryHistory& operator=(const TelemetryHistory&) = delete;
+
+    // ingest: false if the robot cannot be added or the sample is older than
+    // the newest one stored for that robot
+    bool append(const RobotTelemetry& telemetry);
+
+    // calls fn(const RawSegment&) for the samples with from <= timestamp <= to,
+    // returns the number of samples visited
+    template<typename Fn>
+    std::size_t visitRaw(const std::string& id, uint64_t from, uint64_t to, Fn fn) const
+    {
+        std::size_t robot = index_.find(id);
+        if (robot == index_.capacity())
+            return 0;
+
+        std::lock_guard<std::mutex> lock(robotMutex(robot));
+        std::size_t base = robot * config_.raw_capacity;
+        Range range = locate(raw_rings_[robot], config_.raw_capacity, &raw_time_[base], from, to);
+
+        for (int part = 0; part < 2; part++)
+        {
+            if (range.count[part] == 0)
+                continue;
+
+            std::size_t first = base + range.begin[part];
+            RawSegment segment;
+            segment.count = range.count[part];
+            segment.timestamp = &raw_time_[first];
+            for (std::size_t m = 0; m < kMetrics; m++)
+                segment.values[m] = &raw_values_[m][first];
+            fn(segment);
+        }
+
+        return range.count[0] + range.count[1];
+    }
+
+    // calls fn(const RollupSegment&) for the buckets with from <= start <= to,
+    // returns the number of buckets visited
+    template<typename Fn>
+    std::size_t visitRollup(const std::string& id, Tier tier, uint64_t from, uint64_t to, Fn fn) const
+    {
+        std::size_t robot = index_.find(id);
+        if (robot == index_.capacity())
+            return 0;
+
+        const TierData& data = tiers_[static_cast<std::size_t>(tier)];
+        std::lock_guard<std::mutex> lock(robotMutex(robot));
+        std::size_t base = robot * data.capacity;
+        Range range = locate(data.rings[robot], data.capacity, &data.start[base], from, to);
+
+        for (int part = 0; part < 2; part++)
+        {
+            if (range.count[part] == 0)
+                continue;
+
+            std::size_t first = base + range.begin[part];
+            RollupSegment segment;
+            segment.count = range.count[part];
+            segment.start = &data.start[first];
+            segment.samples = &data.samples[first];
+            for (std::size_t m = 0; m < kMetrics; m++)
+            {
+                segment.min[m] = &data.min[m][first];
+                segment.max[m] = &data.max[m][first];
+                segment.mean[m] = &data.mean[m][first];
+            }
+            fn(segment);
+        }
+
+        return range.count[0] + range.count[1];
+    }
+
+    // bucket width of a tier (ns)
+    static uint64_t tierWidth(Tier tier);
+    static const char* tierName(Tier tier);
+
+    static std::size_t bytesPerRobot(const Config& config);
+    std::size_t memoryBytes() const;
+
+    const Config& getConfig() const { return config_; }
+    std::size_t size() const { return index_.size(); }
+    // robots are numbered in the order they were first seen
+    std::string robotId(std::size_t robot) const { return index_.id(robot); }
+    uint64_t getRejected() const { return rejected_.load(std::memory_order_relaxed); }
+
+private:
+    // one lock per group of robots: ingest and queries of different robots rarely meet
+    static const std::size_t kLockStripes = 64;
+
+    struct Ring
+    {
+        uint32_t head;                           // next position written
+        uint32_t count;
+    };
+
+    struct Range
+    {
+        std::size_t begin[2];
+        std::size_t count[2];
+    };
+
+    struct TierData
+    {
+        std::size_t capacity;
+        uint64_t width;
+        std::unique_ptr<Ring[]> rings;
+        std::unique_ptr<uint64_t[]> start;
+        std::unique_ptr<uint32_t[]> samples;
+        std::unique_ptr<float[]> min[kMetrics];
+        std::unique_ptr<float[]> max[kMetrics];
+        std::unique_ptr<float[]> mean[kMetrics];
+    };
+
+    Config config_;
+    RobotIndex index_;
+
+    std::unique_ptr<Ring[]> raw_rings_;
+    std::unique_ptr<uint64_t[]> raw_time_;
+    std::unique_ptr<float[]> raw_values_[kMetrics];
+
+    TierData tiers_[kTiers];
+
+    mutable std::mutex locks_[kLockStripes];
+    std::atomic<uint64_t> rejected_;
+
+    std::mutex& robotMutex(std::size_t robot) const { return locks_[robot % kLockStripes]; }
+
+    // positions of the entries with from <= time <= to (binary search, times are ascending)
+    static Range locate(const Ring& ring, std::size_t capacity, const uint64_t* times, uint64_t from, uint64_t to);
+
+    void addToTier(TierData& tier, std::size_t robot, uint64_t timestamp, const float* values);
+};
+
+#endif // TELEMETRY_HISTORY_HPP
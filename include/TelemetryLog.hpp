@@ -0,0 +1,84 @@
+#ifndef TELEMETRY_LOG_HPP
+#define TELEMETRY_LOG_HPP
+
+#include "AsyncLogger.hpp"
+#include "RobotModels.hpp"
+#include "RobotTelemetry.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <ostream>
+#include <string>
+
+/**
+ * @brief Telemetry console lines, formatted on the AsyncLogger thread
+ *
+ * The hot path only copies the fields into a Record; the text is built by
+ * the logger's writer thread.
+ */
+namespace TelemetryLog
+{
+    struct Record
+    {
+        char id[32];
+        double x;
+        double y;
+        double orientation;
+        double speed;
+        uint64_t timestamp;
+        float battery_level;
+        RobotStatus status;
+        uint32_t count;        // message number
+        int32_t peers;         // matched subscribers (publisher side)
+    };
+
+    inline Record makeRecord(const RobotTelemetry& telemetry, uint32_t count, int32_t peers = 0)
+    {
+        Record record;
+        std::size_t length = std::min(telemetry.id().size(), sizeof(record.id) - 1);
+        std::memcpy(record.id, telemetry.id().data(), length);
+        record.id[length] = '\0';
+        record.x = telemetry.x();
+        record.y = telemetry.y();
+        record.orientation = telemetry.orientation();
+        record.speed = telemetry.speed();
+        record.timestamp = telemetry.timestamp();
+        record.battery_level = telemetry.battery_level();
+        record.status = telemetry.status();
+        record.count = count;
+        record.peers = peers;
+        return record;
+    }
+
+    // one line per published sample (publisher executable)
+    inline void formatPublished(const Record& r, std::ostream& out)
+    {
+        out << "[Main] Msg #" << std::setw(4) << r.count
+            << " | Pos: (" << std::fixed << std::setprecision(2)
+            << std::setw(6) << r.x
+            << ", " << std::setw(6) << r.y << ")"
+            << " | θ: " << std::setw(5) << r.orientation
+            << " | Battery: " << std::setw(5) << r.battery_level << "%"
+            << " | Speed: " << std::setw(4) << r.speed << " m/s"
+            << " | Status: " << std::setw(12) << std::left << RobotModels::statusName(r.status) << std::right
+            << " | Subs: " << r.peers
+            << '\n';
+    }
+
+    // block per received sample (subscriber)
+    inline void formatReceived(const Record& r, std::ostream& out)
+    {
+        out << "\n[Subscriber] Mesaj #" << r.count << " primit:" << '\n';
+        out << "  Robot ID:    " << r.id << '\n';
+        out << "  Poziție:     (" << std::fixed << std::setprecision(2)
+            << r.x << ", " << r.y << ") m" << '\n';
+        out << "  Orientare:   " << r.orientation << " rad" << '\n';
+        out << "  Baterie:     " << r.battery_level << "%" << '\n';
+        out << "  Viteză:      " << r.speed << " m/s" << '\n';
+        out << "  Status:      " << RobotModels::statusName(r.status) << '\n';
+        out << "  Timestamp:   " << r.timestamp << " ns" << '\n';
+        out << std::string(50, '-') << '\n';
+    }
+}
+
+#endif // TELEMETRY_LOG_HPP
@@ -0,0 +1,120 @@
+#ifndef TELEMETRY_RECORDER_HPP
+#define TELEMETRY_RECORDER_HPP
+
+#include "TelemetryRecording.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Appends received telemetry to memory-mapped segment files
+ * (format in TelemetryRecording.hpp)
+ *
+ * record() runs on the ingest thread and only copies one 96-byte record
+ * into the mapped segment; there is no system call and no allocation on
+ * that path. A background thread does the slow parts:
+ *   - creates and preallocates the next segment (fallocate + prefaulted
+ *     mapping) before the current one fills up; it keeps a temporary name
+ *     (pendingSegmentPath) until the ingest thread starts writing it, so a
+ *     crash never leaves an empty segment in the recording,
+ *   - msyncs every completed page of the current segment as it goes,
+ *   - closes full segments (header record_count, truncate, unmap).
+ *
+ * A crashed process loses nothing (the pages are in the page cache); an OS
+ * crash or power loss loses the page being written plus what was written
+ * while the last msync ran. The reader cuts a segment at the first bad record.
+ */
+class TelemetryRecorder
+{
+public:
+    struct Config
+    {
+        std::string directory;       // must exist
+        uint64_t segment_records;    // records per segment file
+        uint64_t index_stride;       // records per time index entry
+        int idle_sleep_ms;           // sync thread pause when there is nothing to sync
+    };
+
+    // 1M records (96 MB) per segment, one index entry every 1024 records
+    static Config defaultConfig(const std::string& directory);
+
+    TelemetryRecorder();
+    ~TelemetryRecorder();
+
+    TelemetryRecorder(const TelemetryRecorder&) = delete;
+    TelemetryRecorder& operator=(const TelemetryRecorder&) = delete;
+
+    // creates the first segment (numbering continues after existing ones)
+    bool start(const Config& config);
+    // closes the current segment; no record() may run concurrently
+    void stop();
+    bool isRunning() const { return running_.load(std::memory_order_acquire); }
+
+    // one ingest thread; false if the sample was dropped (no segment available)
+    bool record(const RobotTelemetry& telemetry);
+
+    uint64_t getRecorded() const { return recorded_.load(std::memory_order_relaxed); }
+    uint64_t getDropped() const { return dropped_.load(std::memory_order_relaxed); }
+    // times record() had to wait for the next segment to be created
+    uint64_t getStalls() const { return stalls_.load(std::memory_order_relaxed); }
+    uint64_t getSegments() const { return segments_.load(std::memory_order_relaxed); }
+
+private:
+    struct Segment
+    {
+        int fd;
+        uint64_t number;
+        std::string path;                    // current name on disk
+        bool pending;                        // path is still the temporary name
+        char* base;
+        std::size_t bytes;
+        TelemetryRecording::SegmentHeader* header;
+        TelemetryRecording::IndexEntry* index;
+        TelemetryRecording::Record* records;
+        std::atomic<uint64_t> committed;     // records written (released by record())
+        std::size_t synced;                  // bytes msync'ed, from the file start
+    };
+
+    Config config_;
+    std::size_t page_size_;
+
+    // ingest thread
+    std::unique_ptr<Segment> current_;
+    uint64_t count_;                         // records in current_
+    int64_t last_ns_;
+
+    // handoff with the sync thread, guarded by mutex_
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::unique_ptr<Segment> next_;
+    std::vector<std::unique_ptr<Segment>> retired_;
+    Segment* syncing_;                       // current_ as seen by the sync thread
+    uint64_t next_number_;
+    bool failed_;
+    bool stopping_;
+    std::thread sync_thread_;
+    std::atomic<bool> running_;
+
+    std::atomic<uint64_t> recorded_;
+    std::atomic<uint64_t> dropped_;
+    std::atomic<uint64_t> stalls_;
+    std::atomic<uint64_t> segments_;
+
+    std::unique_ptr<Segment> createSegment(uint64_t number);
+    // renames a pending segment to its segmentPath() name
+    bool activateSegment(Segment& segment);
+    // msync the completed pages, returns true if something was synced
+    bool syncCommitted(Segment& segment);
+    void closeSegment(std::unique_ptr<Segment> segment);
+    void discardSegment(std::unique_ptr<Segment> segment);
+    bool rotate();
+    void syncLoop();
+};
+
+#endif // TELEMETRY_RECORDER_HPP
@@ -0,0 +1,137 @@
+#ifndef TELEMETRY_RECORDING_HPP
+#define TELEMETRY_RECORDING_HPP
+
+#include "RobotTelemetry.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief On-disk format of recorded telemetry, and a reader for one segment
+ *
+ * A recording is a directory of preallocated segment files
+ * (segment-000001.rtrec, ...). Each file holds:
+ *   - a 4 KB SegmentHeader,
+ *   - a sparse time index (one IndexEntry every index_stride records),
+ *   - fixed-size 96-byte Records in arrival order.
+ *
+ * Every record carries its number and a checksum, so after a crash the
+ * valid prefix of a segment is found without trusting the header; the
+ * header's record_count is only written when a segment is closed cleanly.
+ * Integers are stored in host byte order (recorder and reader on the same
+ * kind of host).
+ */
+namespace TelemetryRecording
+{
+    const char kMagic[8] = {'R', 'T', 'R', 'E', 'C', 0, 0, 1};
+    const uint32_t kVersion = 1;
+    const std::size_t kHeaderSize = 4096;
+    const std::size_t kIdSize = 32;
+
+    struct SegmentHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t record_size;
+        uint64_t segment;            // number within the recording, from 1
+        uint64_t capacity;           // records
+        uint64_t index_stride;       // records per index entry
+        uint64_t index_offset;       // bytes from the start of the file
+        uint64_t records_offset;
+        int64_t created_ns;
+        // written when the segment is closed cleanly
+        uint64_t record_count;
+        int64_t first_ns;
+        int64_t last_ns;
+        uint32_t closed;
+        uint32_t reserved;
+    };
+
+    struct IndexEntry
+    {
+        int64_t recorded_ns;         // 0 = not written
+        uint64_t record;
+    };
+
+    struct Record
+    {
+        uint32_t sequence;           // record number + 1 (0 = never written)
+        uint32_t checksum;           // over the rest of the record
+        int64_t recorded_ns;         // reception time (system clock), the index key
+        char id[kIdSize];
+        double x;
+        double y;
+        double orientation;
+        double speed;
+        uint64_t timestamp;          // publisher timestamp (ns)
+        float battery_level;
+        RobotStatus status;
+    };
+
+    static_assert(sizeof(Record) == 96, "Record layout changed");
+    static_assert(sizeof(SegmentHeader) <= kHeaderSize, "SegmentHeader too large");
+
+    uint32_t checksum(const Record& record);
+
+    // fills every field but sequence and checksum; ids are cut to kIdSize - 1
+    void fillRecord(Record& record, const RobotTelemetry& telemetry, int64_t recorded_ns);
+    void toTelemetry(const Record& record, RobotTelemetry& telemetry);
+
+    std::string segmentPath(const std::string& directory, uint64_t segment);
+    // name of a segment while it is preallocated but not yet written to; it
+    // gets the segmentPath() name when the recorder starts writing it
+    std::string pendingSegmentPath(const std::string& directory, uint64_t segment);
+    // segment files of a recording, in order (pending ones are not listed)
+    std::vector<std::string> listSegments(const std::string& directory);
+    // highest segment number in the directory, 0 if none
+    uint64_t lastSegmentNumber(const std::string& directory);
+    // deletes pending segments left by a recorder that did not stop cleanly
+    std::size_t removePendingSegments(const std::string& directory);
+
+    /**
+     * @brief Read-only mapping of one segment file
+     *
+     * A segment that was not closed cleanly (recorder crash, or still being
+     * written) is cut at the first record with a bad number or checksum.
+     */
+    class SegmentReader
+    {
+    public:
+        SegmentReader();
+        ~SegmentReader();
+
+        SegmentReader(const SegmentReader&) = delete;
+        SegmentReader& operator=(const SegmentReader&) = delete;
+
+        bool open(const std::string& path);
+        void close();
+
+        bool isOpen() const { return base_ != nullptr; }
+        // false if the valid records were recovered by scanning
+        bool wasClosed() const { return header_->closed != 0; }
+        const SegmentHeader& header() const { return *header_; }
+
+        uint64_t size() const { return count_; }
+        const Record& record(uint64_t i) const { return records_[i]; }
+        // contiguous array of size() records
+        const Record* records() const { return records_; }
+
+        // first record with recorded_ns >= time (size() if none), using the time index
+        uint64_t seek(int64_t time) const;
+
+    private:
+        int fd_;
+        char* base_;
+        std::size_t bytes_;
+        const SegmentHeader* header_;
+        const IndexEntry* index_;
+        const Record* records_;
+        uint64_t count_;
+
+        bool valid(uint64_t i) const;
+        uint64_t recover() const;
+    };
+}
+
+#endif // TELEMETRY_RECORDING_HPP
@@ -0,0 +1,81 @@
+#ifndef TICK_SCHEDULER_HPP
+#define TICK_SCHEDULER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Fixed-rate loop timing on absolute deadlines
+ *
+ * Tick n is due at start + n * period on the monotonic clock, no matter
+ * how long the work between two wait() calls took, so the average rate
+ * does not drift. wait() sleeps with clock_nanosleep(TIMER_ABSTIME) and can
+ * busy-wait the last `spin_ns` before the deadline for sub-millisecond jitter
+ * (at the price of one busy core while it spins).
+ *
+ * When the work overruns one or more deadlines:
+ *   CATCH_UP  every missed tick still runs, back to back, until on time again
+ *   SKIP      the missed ticks are dropped and the loop continues on the grid
+ */
+class TickScheduler
+{
+public:
+    enum class Policy
+    {
+        CATCH_UP,
+        SKIP
+    };
+
+    struct Stats
+    {
+        uint64_t ticks;
+        uint64_t overruns;          // wait() called after the deadline had passed
+        uint64_t skipped;           // ticks dropped by SKIP
+        double mean_jitter_us;      // wake-up time - deadline
+        double p99_jitter_us;
+        double max_jitter_us;
+    };
+
+    explicit TickScheduler(double rate_hz, Policy policy = Policy::SKIP, int64_t spin_ns = 0);
+
+    // first tick is due one period from now
+    void start();
+
+    // blocks until the next tick is due; returns how many periods it
+    // advances (1, or more when SKIP dropped ticks) so callers can scale dt
+    uint64_t wait();
+
+    // takes effect from the next deadline
+    void setRate(double rate_hz);
+    double getRate() const { return 1e9 / period_ns_; }
+    int64_t getPeriodNs() const { return period_ns_; }
+
+    Stats getStats() const;
+    void printStats(const char* name) const;
+    void resetStats();
+
+    // CLOCK_MONOTONIC in ns
+    static int64_t nowNs();
+
+private:
+    // 1 us buckets up to kJitterBuckets us, the last one collects the rest
+    static const std::size_t kJitterBuckets = 4096;
+
+    int64_t period_ns_;
+    Policy policy_;
+    int64_t spin_ns_;
+    int64_t deadline_ns_;
+
+    uint64_t ticks_;
+    uint64_t overruns_;
+    uint64_t skipped_;
+    double total_jitter_us_;
+    double max_jitter_us_;
+    std::vector<uint64_t> jitter_histogram_;
+
+    void sleepUntil(int64_t deadline_ns) const;
+    void recordJitter(int64_t late_ns);
+};
+
+#endif // TICK_SCHEDULER_HPP
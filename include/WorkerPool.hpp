@@ -0,0 +1,67 @@
+#ifndef WORKER_POOL_HPP
+#define WORKER_POOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fixed pool of worker threads running one range job at a time
+ *
+ * run(count, job) splits [0, count) into one contiguous range per worker
+ * and returns once every worker is done with its range. FleetStepper runs
+ * on it, and so does work that is not a FleetSimulator (e.g. many
+ * RobotSimulator + RobotPublisher pairs stepped every tick).
+ *
+ * Workers are pinned to cores (worker i -> core i % cores) when requested.
+ * Each worker's busy time and CPU time are kept to size hosts.
+ */
+class WorkerPool
+{
+public:
+    using RangeJob = std::function<void(std::size_t worker, std::size_t begin, std::size_t end)>;
+
+    explicit WorkerPool(std::size_t threads, bool pin_threads = false);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    // blocks until `job` ran on every non-empty range of [0, count); ranges
+    // start on a multiple of `alignment` items
+    void run(std::size_t count, const RangeJob& job, std::size_t alignment = 1);
+
+    std::size_t getThreadCount() const { return workers_.size(); }
+    // busy time of each worker in the last run() (us)
+    const std::vector<double>& getLastWorkerTimes() const { return worker_us_; }
+    // CPU time used by all workers since construction (ns), read after run()
+    int64_t getCpuNs() const;
+
+private:
+    std::vector<std::thread> workers_;
+
+    // dispatch state, guarded by mutex_
+    std::mutex mutex_;
+    std::condition_variable start_cv_;
+    std::condition_variable done_cv_;
+    bool exit_;
+    uint64_t generation_;
+    std::size_t pending_;
+    std::size_t count_;
+    std::size_t alignment_;
+    const RangeJob* job_;
+
+    std::vector<double> worker_us_;
+    // each worker's thread CPU time after its last job
+    std::vector<int64_t> worker_cpu_ns_;
+
+    void workerLoop(std::size_t worker, bool pin);
+    void range(std::size_t count, std::size_t alignment, std::size_t worker,
+               std::size_t& begin, std::size_t& end) const;
+};
+
+#endif // WORKER_POOL_HPP
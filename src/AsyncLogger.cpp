@@ -0,0 +1,239 @@
+#include "AsyncLogger.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <sstream>
+
+namespace
+{
+    struct TextRecord
+    {
+        char text[AsyncLogger::kPayloadSize];
+    };
+
+    void formatText(const TextRecord& record, std::ostream& out)
+    {
+        out << record.text << '\n';
+    }
+
+    std::size_t roundUpPow2(std::size_t value)
+    {
+        std::size_t result = 2;
+        while (result < value)
+            result <<= 1;
+        return result;
+    }
+}
+
+constexpr std::size_t AsyncLogger::kPayloadSize;
+constexpr std::size_t AsyncLogger::kRecordSize;
+constexpr std::size_t AsyncLogger::kSampleSlots;
+
+AsyncLogger& AsyncLogger::instance()
+{
+    static AsyncLogger logger;
+    return logger;
+}
+
+AsyncLogger::AsyncLogger()
+    : mask_(0)
+    , enqueue_pos_(0)
+    , dequeue_pos_(0)
+    , running_(false)
+    , stopping_(false)
+    , producers_(0)
+    , sample_counters_(kSampleSlots * static_cast<std::size_t>(Category::COUNT))
+    , dropped_(0)
+    , written_(0)
+{
+    for (auto& every : sampling_)
+        every.store(1, std::memory_order_relaxed);
+    for (auto& counter : sample_counters_)
+        counter.store(0, std::memory_order_relaxed);
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    stop();
+}
+
+void AsyncLogger::start(std::size_t capacity)
+{
+    if (running_.load(std::memory_order_acquire))
+        return;
+
+    capacity = roundUpPow2(capacity);
+    slots_ = std::vector<Slot>(capacity);
+    for (std::size_t i = 0; i < capacity; i++)
+        slots_[i].sequence.store(i, std::memory_order_relaxed);
+
+    mask_ = capacity - 1;
+    enqueue_pos_.store(0, std::memory_order_relaxed);
+    dequeue_pos_ = 0;
+    stopping_.store(false, std::memory_order_relaxed);
+
+    running_.store(true, std::memory_order_release);
+    writer_ = std::thread(&AsyncLogger::writerLoop, this);
+}
+
+void AsyncLogger::stop()
+{
+    if (!running_.load(std::memory_order_acquire))
+        return;
+
+    stopping_.store(true, std::memory_order_release);
+    writer_.join();
+    running_.store(false, std::memory_order_release);
+
+    uint64_t dropped = dropped_.load(std::memory_order_relaxed);
+    if (dropped > 0)
+        std::cout << "[Logger] " << dropped << " records dropped (ring full or logger stopping)" << std::endl;
+}
+
+void AsyncLogger::setSampling(Category category, uint32_t every)
+{
+    sampling_[static_cast<std::size_t>(category)].store(every, std::memory_order_relaxed);
+}
+
+uint32_t AsyncLogger::samplingFromArgs(int argc, char** argv, uint32_t default_every)
+{
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (std::string(argv[i]) == "--log-every")
+            return static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+    }
+    return default_every;
+}
+
+bool AsyncLogger::sample(Category category, const std::string& key)
+{
+    uint32_t every = sampling_[static_cast<std::size_t>(category)].load(std::memory_order_relaxed);
+    if (every <= 1)
+        return every == 1;
+
+    // two keys may share a counter; that only shifts which of their records are kept
+    std::size_t slot = std::hash<std::string>()(key) & (kSampleSlots - 1);
+    std::size_t index = static_cast<std::size_t>(category) * kSampleSlots + slot;
+
+    return sample_counters_[index].fetch_add(1, std::memory_order_relaxed) % every == 0;
+}
+
+bool AsyncLogger::text(Category category, const std::string& line)
+{
+    TextRecord record;
+    std::size_t length = std::min(line.size(), sizeof(record.text) - 1);
+    std::memcpy(record.text, line.data(), length);
+    record.text[length] = '\0';
+
+    return log(category, &formatText, record);
+}
+
+bool AsyncLogger::push(Category category, Trampoline trampoline, const void* record, std::size_t size)
+{
+    if (!running_.load(std::memory_order_acquire))
+    {
+        // not started: behave like a plain print
+        trampoline(record, std::cout);
+        std::cout.flush();
+        return true;
+    }
+
+    // announced before stopping_ is read (both seq_cst): either this push sees
+    // stopping_, or the writer sees it in flight and waits for it before its
+    // last drain
+    producers_.fetch_add(1);
+    bool pushed = !stopping_.load() && enqueue(category, trampoline, record, size);
+    if (!pushed)
+    {
+        // ring full, or the writer is about to drain for the last time
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+    producers_.fetch_sub(1, std::memory_order_release);
+    return pushed;
+}
+
+bool AsyncLogger::enqueue(Category category, Trampoline trampoline, const void* record, std::size_t size)
+{
+    // bounded MPMC ring (Vyukov): a slot is free for position `pos` when its
+    // sequence equals pos, and readable when it equals pos + 1
+    std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true)
+    {
+        slot = &slots_[pos & mask_];
+        std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+        if (diff == 0)
+        {
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0)
+        {
+            // full: never wait for the console
+            return false;
+        }
+        else
+        {
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->trampoline = trampoline;
+    slot->category = category;
+    std::memcpy(slot->record, record, size);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+std::size_t AsyncLogger::drain()
+{
+    std::ostringstream batch;
+    std::size_t count = 0;
+
+    while (true)
+    {
+        Slot& slot = slots_[dequeue_pos_ & mask_];
+        if (slot.sequence.load(std::memory_order_acquire) != dequeue_pos_ + 1)
+            break;
+
+        slot.trampoline(slot.record, batch);
+        slot.sequence.store(dequeue_pos_ + mask_ + 1, std::memory_order_release);
+        dequeue_pos_++;
+        count++;
+    }
+
+    if (count > 0)
+    {
+        // one write and one flush per batch
+        const std::string& text = batch.str();
+        std::cout.write(text.data(), static_cast<std::streamsize>(text.size()));
+        std::cout.flush();
+        written_.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    return count;
+}
+
+void AsyncLogger::writerLoop()
+{
+    while (!stopping_.load(std::memory_order_acquire))
+    {
+        if (drain() == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // a producer that missed stopping_ may still be claiming or publishing a
+    // slot, and a slot claimed but not yet published would end drain() early
+    while (producers_.load() != 0)
+        std::this_thread::yield();
+    drain();
+
+    // nothing can be left once every producer is out, but never lose one silently
+    std::size_t left = enqueue_pos_.load(std::memory_order_acquire) - dequeue_pos_;
+    if (left > 0)
+        dropped_.fetch_add(left, std::memory_order_relaxed);
+}
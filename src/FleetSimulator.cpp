@@ -0,0 +1,326 @@
+#include "FleetSimulator.hpp"
+#include "RobotModels.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+FleetSimulator::FleetSimulator()
+    : has_pending_(false)
+    , time_(0.0)
+    , isa_(SimdKernels::detectIsa())
+{
+}
+
+void FleetSimulator::reserve(std::size_t count)
+{
+    ids_.reserve(count);
+    x_.reserve(count);
+    y_.reserve(count);
+    orientation_.reserve(count);
+    motion_mode_.reserve(count);
+    velocity_.reserve(count);
+    angular_velocity_.reserve(count);
+    motion_angle_.reserve(count);
+    linear_vx_.reserve(count);
+    linear_vy_.reserve(count);
+    circle_radius_.reserve(count);
+    circle_center_x_.reserve(count);
+    circle_center_y_.reserve(count);
+    phase_group_.reserve(count);
+    battery_level_.reserve(count);
+    battery_drain_rate_.reserve(count);
+    battery_charge_rate_.reserve(count);
+    low_battery_threshold_.reserve(count);
+    is_charging_.reserve(count);
+    moving_.reserve(count);
+    pending_.reserve(count);
+}
+
+// same defaults as RobotSimulator::RobotSimulator
+std::size_t FleetSimulator::addRobot(const std::string& robot_id)
+{
+    ids_.push_back(robot_id);
+    x_.push_back(0.0);
+    y_.push_back(0.0);
+    orientation_.push_back(0.0);
+    motion_mode_.push_back(static_cast<uint8_t>(MotionMode::STATIONARY));
+    velocity_.push_back(0.0);
+    angular_velocity_.push_back(0.2);
+    motion_angle_.push_back(0.0);
+    linear_vx_.push_back(0.0);
+    linear_vy_.push_back(0.0);
+    circle_radius_.push_back(5.0);
+    circle_center_x_.push_back(0.0);
+    circle_center_y_.push_back(0.0);
+    phase_group_.push_back(0);
+    battery_level_.push_back(100.0f);
+    battery_drain_rate_.push_back(0.1f);    // 0.1% per sec
+    battery_charge_rate_.push_back(1.0f);   // 1% per sec
+    low_battery_threshold_.push_back(20.0f);
+    is_charging_.push_back(0);
+    moving_.push_back(0);
+    pending_.push_back(0);
+
+    return ids_.size() - 1;
+}
+
+// main update - one pass over the buffers, called every tick
+void FleetSimulator::update(double dt)
+{
+    updatePhaseGroups(0, phaseGroupCount());
+    updateRange(0, ids_.size(), dt);
+
+    //increment total time
+    advanceTime(dt);
+}
+
+void FleetSimulator::updateRange(std::size_t begin, std::size_t end, double dt)
+{
+    // motion and battery are stepped block by block so the battery kernel
+    // reads velocities that are still in cache
+    for (std::size_t block = begin; block < end; block += kBlockSize)
+    {
+        std::size_t block_end = std::min(end, block + kBlockSize);
+        if (has_pending_)
+            resolvePending(block, block_end);
+        updateMotion(block, block_end, dt);
+
+        SimdKernels::batteryStep(isa_, block_end - block, dt,
+                                 moving_.data() + block,
+                                 battery_drain_rate_.data() + block,
+                                 battery_charge_rate_.data() + block,
+                                 battery_level_.data() + block,
+                                 is_charging_.data() + block);
+    }
+}
+
+void FleetSimulator::advanceTime(double dt)
+{
+    // every range has been stepped, so no robot is pending anymore
+    has_pending_ = false;
+    time_ += dt;
+}
+
+// robots set or reset since the last update start deriving their state from now on
+void FleetSimulator::resolvePending(std::size_t begin, std::size_t end)
+{
+    for (std::size_t i = begin; i < end; i++)
+    {
+        if (pending_[i] == 0)
+            continue;
+
+        // both constant until the robot's motion is set again
+        if (static_cast<MotionMode>(motion_mode_[i]) == MotionMode::CIRCULAR)
+            velocity_[i] = RobotModels::circularSpeed(circle_radius_[i], angular_velocity_[i]);
+        moving_[i] = isMoving(i) ? 1 : 0;
+        pending_[i] = 0;
+    }
+}
+
+void FleetSimulator::updateMotion(std::size_t begin, std::size_t end, double dt)
+{
+    // circular robots have nothing to step: their position and heading come
+    // from the phase group (see getX), so only linear positions accumulate
+    const uint32_t* linear = linear_robots_.data();
+    const double* linear_vx = linear_vx_.data();
+    const double* linear_vy = linear_vy_.data();
+    double* x = x_.data();
+    double* y = y_.data();
+
+    std::size_t linear_end = linearListPosition(end);
+    for (std::size_t k = linearListPosition(begin); k < linear_end; k++)
+    {
+        uint32_t i = linear[k];
+        RobotModels::linearPosition(linear_vx[i], linear_vy[i], dt, x[i], y[i]);
+    }
+}
+
+// position in linear_robots_ of the first linear robot >= index
+std::size_t FleetSimulator::linearListPosition(std::size_t index) const
+{
+    return std::lower_bound(linear_robots_.begin(), linear_robots_.end(), static_cast<uint32_t>(index))
+        - linear_robots_.begin();
+}
+
+// the stored x/y/orientation become the robot's current state, to change its motion
+void FleetSimulator::materialize(std::size_t index)
+{
+    double x = getX(index);
+    double y = getY(index);
+    double orientation = getOrientation(index);
+
+    x_[index] = x;
+    y_[index] = y;
+    orientation_[index] = orientation;
+
+    pending_[index] = 1;
+    has_pending_ = true;
+}
+
+// keeps linear_robots_ sorted by robot index
+void FleetSimulator::setMotionMode(std::size_t index, MotionMode mode)
+{
+    MotionMode old_mode = static_cast<MotionMode>(motion_mode_[index]);
+    motion_mode_[index] = static_cast<uint8_t>(mode);
+    if (old_mode == mode)
+        return;
+
+    if (old_mode == MotionMode::LINEAR)
+        linear_robots_.erase(linear_robots_.begin() + linearListPosition(index));
+
+    // robots are usually configured in index order: this appends
+    if (mode == MotionMode::LINEAR)
+        linear_robots_.insert(linear_robots_.begin() + linearListPosition(index), static_cast<uint32_t>(index));
+}
+
+double FleetSimulator::getX(std::size_t index) const
+{
+    if (!isDerived(index, MotionMode::CIRCULAR))
+        return x_[index];
+    return circle_center_x_[index] + circle_radius_[index] * group_cos_[phase_group_[index]];
+}
+
+double FleetSimulator::getY(std::size_t index) const
+{
+    if (!isDerived(index, MotionMode::CIRCULAR))
+        return y_[index];
+    return circle_center_y_[index] + circle_radius_[index] * group_sin_[phase_group_[index]];
+}
+
+double FleetSimulator::getOrientation(std::size_t index) const
+{
+    if (isDerived(index, MotionMode::CIRCULAR))
+        return group_orientation_[phase_group_[index]];
+    if (isDerived(index, MotionMode::LINEAR))
+        return motion_angle_[index];
+    return orientation_[index];
+}
+
+// cos/sin/heading of the phase groups in [begin, end) at the current time
+void FleetSimulator::updatePhaseGroups(std::size_t begin, std::size_t end)
+{
+    SimdKernels::circularPhase(isa_, end - begin,
+                               group_angular_velocity_.data() + begin, time_,
+                               group_cos_.data() + begin, group_sin_.data() + begin,
+                               group_orientation_.data() + begin);
+}
+
+uint32_t FleetSimulator::phaseGroup(double angular_velocity)
+{
+    auto it = group_index_.find(angular_velocity);
+    if (it != group_index_.end())
+        return it->second;
+
+    uint32_t g = static_cast<uint32_t>(group_angular_velocity_.size());
+    group_index_.emplace(angular_velocity, g);
+    group_angular_velocity_.push_back(angular_velocity);
+    group_cos_.push_back(1.0);
+    group_sin_.push_back(0.0);
+    group_orientation_.push_back(0.0);
+
+    return g;
+}
+
+bool FleetSimulator::isMoving(std::size_t index) const
+{
+    return static_cast<MotionMode>(motion_mode_[index]) != MotionMode::STATIONARY
+        && velocity_[index] > 0.0;
+}
+
+RobotTelemetry FleetSimulator::generateTelemetry(std::size_t index) const
+{
+    RobotTelemetry telemetry;
+    fillTelemetry(index, telemetry);
+    return telemetry;
+}
+
+void FleetSimulator::fillTelemetry(std::size_t index, RobotTelemetry& telemetry) const
+{
+    telemetry.id().assign(ids_[index]);
+    telemetry.x(getX(index));
+    telemetry.y(getY(index));
+    telemetry.orientation(getOrientation(index));
+    telemetry.battery_level(battery_level_[index]);
+    telemetry.speed(velocity_[index]);
+    telemetry.status(RobotModels::status(is_charging_[index] != 0, battery_level_[index],
+                                         low_battery_threshold_[index], isMoving(index)));
+
+    auto now = std::chrono::system_clock::now();
+    auto duration = now.time_since_epoch();
+    uint64_t timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    telemetry.timestamp(timestamp_ns);
+}
+
+void FleetSimulator::setCircularMotion(std::size_t index, double radius, double angular_velocity)
+{
+    materialize(index);
+    setMotionMode(index, MotionMode::CIRCULAR);
+    circle_radius_[index] = radius;
+    angular_velocity_[index] = angular_velocity;
+    phase_group_[index] = phaseGroup(angular_velocity);
+
+    circle_center_x_[index] = x_[index];
+    circle_center_y_[index] = y_[index];
+}
+
+void FleetSimulator::setLinearMotion(std::size_t index, double velocity, double angle)
+{
+    materialize(index);
+    setMotionMode(index, MotionMode::LINEAR);
+    velocity_[index] = velocity;
+    motion_angle_[index] = angle;
+
+    linear_vx_[index] = velocity * std::cos(angle);
+    linear_vy_[index] = velocity * std::sin(angle);
+}
+
+void FleetSimulator::setStationary(std::size_t index, double x, double y)
+{
+    materialize(index);
+    setMotionMode(index, MotionMode::STATIONARY);
+    x_[index] = x;
+    y_[index] = y;
+    velocity_[index] = 0.0;
+}
+
+void FleetSimulator::setBatteryDrainRate(std::size_t index, float rate)
+{
+    battery_drain_rate_[index] = rate;
+}
+
+void FleetSimulator::setBatteryChargeRate(std::size_t index, float rate)
+{
+    battery_charge_rate_[index] = rate;
+}
+
+void FleetSimulator::setLowBatteryThreshold(std::size_t index, float threshold)
+{
+    low_battery_threshold_[index] = threshold;
+}
+
+void FleetSimulator::setBatteryLevel(std::size_t index, float level)
+{
+    battery_level_[index] = std::max(0.0f, std::min(100.0f, level));
+
+    if (battery_level_[index] > 0.0f)
+    {
+        is_charging_[index] = 0;
+    }
+}
+
+void FleetSimulator::reset()
+{
+    std::fill(x_.begin(), x_.end(), 0.0);
+    std::fill(y_.begin(), y_.end(), 0.0);
+    std::fill(orientation_.begin(), orientation_.end(), 0.0);
+    std::fill(battery_level_.begin(), battery_level_.end(), 100.0f);
+    std::fill(is_charging_.begin(), is_charging_.end(), 0);
+    std::fill(velocity_.begin(), velocity_.end(), 0.0);
+    // velocity is 0, so the cached linear components are too
+    std::fill(linear_vx_.begin(), linear_vx_.end(), 0.0);
+    std::fill(linear_vy_.begin(), linear_vy_.end(), 0.0);
+    // the zeroed state is what every robot reads until the next update
+    std::fill(pending_.begin(), pending_.end(), 1);
+    has_pending_ = true;
+    time_ = 0.0;
+}
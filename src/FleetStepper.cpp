@@ -0,0 +1,113 @@
+#include "FleetStepper.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+namespace
+{
+    // ranges start on a multiple of 64 robots, so two workers never write
+    // into the same cache line of the uint8_t buffers
+    const std::size_t kRangeAlignment = 64;
+
+    double elapsedUs(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+FleetStepper::FleetStepper(FleetSimulator& fleet, std::size_t threads, bool pin_threads)
+    : fleet_(fleet)
+    , pool_(threads, pin_threads)
+    , dt_(0.0)
+    , after_step_(nullptr)
+    , last_tick_{0.0, 0.0, 0.0, 1.0}
+{
+    phase_groups_job_ = [this](std::size_t, std::size_t begin, std::size_t end)
+    {
+        fleet_.updatePhaseGroups(begin, end);
+    };
+
+    robots_job_ = [this](std::size_t worker, std::size_t begin, std::size_t end)
+    {
+        fleet_.updateRange(begin, end, dt_);
+        if (after_step_ != nullptr)
+            (*after_step_)(worker, begin, end);
+    };
+
+    worker_us_.assign(pool_.getThreadCount(), 0.0);
+    resetStats();
+}
+
+FleetStepper::~FleetStepper()
+{
+}
+
+void FleetStepper::step(double dt, const RangeCallback& after_step)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    std::fill(worker_us_.begin(), worker_us_.end(), 0.0);
+    dt_ = dt;
+    after_step_ = after_step ? &after_step : nullptr;
+
+    // phase groups must be ready before any robot range is stepped
+    pool_.run(fleet_.phaseGroupCount(), phase_groups_job_, kRangeAlignment);
+    addWorkerTimes();
+    pool_.run(fleet_.size(), robots_job_, kRangeAlignment);
+    addWorkerTimes();
+    fleet_.advanceTime(dt);
+
+    after_step_ = nullptr;
+
+    double max_us = *std::max_element(worker_us_.begin(), worker_us_.end());
+    double mean_us = 0.0;
+    for (double us : worker_us_)
+        mean_us += us;
+    mean_us /= static_cast<double>(worker_us_.size());
+
+    last_tick_.wall_us = elapsedUs(start);
+    last_tick_.max_worker_us = max_us;
+    last_tick_.mean_worker_us = mean_us;
+    last_tick_.imbalance = mean_us > 0.0 ? max_us / mean_us : 1.0;
+
+    ticks_++;
+    total_wall_us_ += last_tick_.wall_us;
+    max_wall_us_ = std::max(max_wall_us_, last_tick_.wall_us);
+    total_imbalance_ += last_tick_.imbalance;
+}
+
+// adds the pool's last run to the tick's per-worker busy time
+void FleetStepper::addWorkerTimes()
+{
+    const std::vector<double>& last = pool_.getLastWorkerTimes();
+    for (std::size_t i = 0; i < worker_us_.size(); i++)
+        worker_us_[i] += last[i];
+}
+
+void FleetStepper::printStats() const
+{
+    double mean_wall = ticks_ > 0 ? total_wall_us_ / ticks_ : 0.0;
+    double mean_imbalance = ticks_ > 0 ? total_imbalance_ / ticks_ : 1.0;
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "[FleetStepper] Robots: " << fleet_.size()
+              << " | Threads: " << pool_.getThreadCount()
+              << " | Ticks: " << ticks_ << std::endl;
+    std::cout << "  - Tick wall time: avg " << mean_wall << " us, max " << max_wall_us_ << " us" << std::endl;
+    std::cout << "  - Imbalance:      avg " << std::setprecision(3) << mean_imbalance
+              << " (max/mean worker time, 1.000 = perfect)" << std::endl;
+    std::cout << "  - Last tick per worker (us):";
+    std::cout << std::setprecision(1);
+    for (double us : worker_us_)
+        std::cout << " " << us;
+    std::cout << std::endl;
+}
+
+void FleetStepper::resetStats()
+{
+    ticks_ = 0;
+    total_wall_us_ = 0.0;
+    max_wall_us_ = 0.0;
+    total_imbalance_ = 0.0;
+}
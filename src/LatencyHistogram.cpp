@@ -0,0 +1,111 @@
+#include "LatencyHistogram.hpp"
+#include <algorithm>
+
+const std::size_t LatencyHistogram::kSubBuckets;
+const std::size_t LatencyHistogram::kMaxExponent;
+const std::size_t LatencyHistogram::kBuckets;
+
+namespace
+{
+    std::size_t highestBit(uint64_t value)
+    {
+        return 63 - static_cast<std::size_t>(__builtin_clzll(value));
+    }
+}
+
+LatencyHistogram::LatencyHistogram()
+{
+    reset();
+}
+
+std::size_t LatencyHistogram::bucketOf(uint64_t value_ns)
+{
+    if (value_ns < kSubBuckets)
+        return static_cast<std::size_t>(value_ns);
+
+    // 2^e <= value < 2^(e+1), split into kSubBuckets steps of 2^(e-6)
+    std::size_t exponent = highestBit(value_ns);
+    if (exponent >= kMaxExponent)
+        return kBuckets - 1;
+
+    std::size_t sub = static_cast<std::size_t>(value_ns >> (exponent - 6)) - kSubBuckets;
+    return kSubBuckets + (exponent - 6) * kSubBuckets + sub;
+}
+
+uint64_t LatencyHistogram::bucketUpper(std::size_t bucket)
+{
+    if (bucket < kSubBuckets)
+        return bucket;
+
+    std::size_t exponent = (bucket - kSubBuckets) / kSubBuckets + 6;
+    std::size_t sub = (bucket - kSubBuckets) % kSubBuckets;
+    uint64_t width = uint64_t(1) << (exponent - 6);
+    return (uint64_t(kSubBuckets + sub) << (exponent - 6)) + width - 1;
+}
+
+void LatencyHistogram::record(int64_t latency_ns)
+{
+    if (latency_ns < 0)
+    {
+        negative_.fetch_add(1, std::memory_order_relaxed);
+        latency_ns = 0;
+    }
+
+    uint64_t value = static_cast<uint64_t>(latency_ns);
+    counts_[bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_ns_.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t max = max_ns_.load(std::memory_order_relaxed);
+    while (value > max && !max_ns_.compare_exchange_weak(max, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+LatencyHistogram::Summary LatencyHistogram::summary() const
+{
+    Summary summary = {0, 0, 0.0, 0.0, 0.0, 0.0, 0.0};
+
+    // totals from the buckets, so the percentiles are consistent with each other
+    uint64_t counts[kBuckets];
+    uint64_t total = 0;
+    for (std::size_t i = 0; i < kBuckets; i++)
+    {
+        counts[i] = counts_[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    if (total == 0)
+        return summary;
+
+    double max_us = max_ns_.load(std::memory_order_relaxed) / 1000.0;
+    summary.count = total;
+    summary.negative = negative_.load(std::memory_order_relaxed);
+    summary.mean_us = sum_ns_.load(std::memory_order_relaxed) / 1000.0 / std::max<uint64_t>(1, count_.load(std::memory_order_relaxed));
+    summary.max_us = max_us;
+
+    const double quantiles[3] = {0.50, 0.99, 0.999};
+    double* results[3] = {&summary.p50_us, &summary.p99_us, &summary.p999_us};
+    uint64_t seen = 0;
+    std::size_t q = 0;
+    for (std::size_t i = 0; i < kBuckets && q < 3; i++)
+    {
+        seen += counts[i];
+        while (q < 3 && seen >= static_cast<uint64_t>(quantiles[q] * total + 0.5) && seen > 0)
+        {
+            *results[q] = std::min(bucketUpper(i) / 1000.0, max_us);
+            q++;
+        }
+    }
+
+    return summary;
+}
+
+void LatencyHistogram::reset()
+{
+    for (auto& count : counts_)
+        count.store(0, std::memory_order_relaxed);
+    count_.store(0, std::memory_order_relaxed);
+    negative_.store(0, std::memory_order_relaxed);
+    sum_ns_.store(0, std::memory_order_relaxed);
+    max_ns_.store(0, std::memory_order_relaxed);
+}
@@ -0,0 +1,142 @@
+#include "LatencyTracker.hpp"
+#include "AsyncLogger.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    void printSummary(std::ostream& out, const LatencyHistogram::Summary& s)
+    {
+        out << std::fixed << std::setprecision(1)
+            << "samples: " << s.count
+            << " | p50: " << s.p50_us << " us"
+            << " | p99: " << s.p99_us << " us"
+            << " | p99.9: " << s.p999_us << " us"
+            << " | max: " << s.max_us << " us";
+        if (s.negative > 0)
+            out << " | future timestamps: " << s.negative;
+    }
+}
+
+LatencyTracker::LatencyTracker(const std::string& profile, std::size_t max_robots)
+    : profile_(profile)
+    , index_(max_robots)
+    , robot_histograms_(new LatencyHistogram[max_robots])
+    , reporting_(false)
+{
+}
+
+LatencyTracker::~LatencyTracker()
+{
+    stopReporting();
+}
+
+int64_t LatencyTracker::nowNs()
+{
+    // same clock as RobotSimulator::fillTelemetry()
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+void LatencyTracker::record(const RobotTelemetry& telemetry)
+{
+    record(telemetry.id(), nowNs() - static_cast<int64_t>(telemetry.timestamp()));
+}
+
+void LatencyTracker::record(const std::string& id, int64_t latency_ns)
+{
+    profile_histogram_.record(latency_ns);
+
+    std::size_t robot = index_.insert(id);
+    if (robot != index_.capacity())
+        robot_histograms_[robot].record(latency_ns);
+}
+
+bool LatencyTracker::getRobotSummary(const std::string& id, LatencyHistogram::Summary& summary) const
+{
+    std::size_t robot = index_.find(id);
+    if (robot == index_.capacity())
+        return false;
+
+    summary = robot_histograms_[robot].summary();
+    return true;
+}
+
+void LatencyTracker::report(std::ostream& out, std::size_t worst_robots) const
+{
+    out << "[Latency] " << profile_ << " | ";
+    printSummary(out, profile_histogram_.summary());
+    out << '\n';
+
+    // robots with the highest p99
+    std::vector<std::pair<double, std::size_t>> robots;
+    std::size_t known = index_.size();
+    robots.reserve(known);
+    for (std::size_t robot = 0; robot < known; robot++)
+    {
+        if (robot_histograms_[robot].getCount() > 0)
+            robots.emplace_back(robot_histograms_[robot].summary().p99_us, robot);
+    }
+
+    std::size_t shown = std::min(worst_robots, robots.size());
+    std::partial_sort(robots.begin(), robots.begin() + shown, robots.end(),
+        [](const std::pair<double, std::size_t>& a, const std::pair<double, std::size_t>& b)
+        {
+            return a.first > b.first;
+        });
+
+    for (std::size_t i = 0; i < shown; i++)
+    {
+        out << "[Latency]   " << std::setw(10) << std::left << index_.id(robots[i].second) << std::right << " | ";
+        printSummary(out, robot_histograms_[robots[i].second].summary());
+        out << '\n';
+    }
+}
+
+void LatencyTracker::startReporting(int interval_ms, std::size_t worst_robots)
+{
+    std::lock_guard<std::mutex> lock(report_mutex_);
+    if (reporting_)
+        return;
+
+    reporting_ = true;
+    report_thread_ = std::thread(&LatencyTracker::reportLoop, this, interval_ms, worst_robots);
+}
+
+void LatencyTracker::stopReporting()
+{
+    {
+        std::lock_guard<std::mutex> lock(report_mutex_);
+        reporting_ = false;
+    }
+    report_cv_.notify_all();
+
+    if (report_thread_.joinable())
+        report_thread_.join();
+}
+
+void LatencyTracker::reportLoop(int interval_ms, std::size_t worst_robots)
+{
+    AsyncLogger& logger = AsyncLogger::instance();
+
+    std::unique_lock<std::mutex> lock(report_mutex_);
+    while (reporting_)
+    {
+        report_cv_.wait_for(lock, std::chrono::milliseconds(interval_ms));
+        if (!reporting_ || profile_histogram_.getCount() == 0)
+            continue;
+
+        std::ostringstream out;
+        report(out, worst_robots);
+
+        // one logger record per line
+        std::istringstream lines(out.str());
+        std::string line;
+        while (std::getline(lines, line))
+            logger.text(AsyncLogger::Category::GENERAL, line);
+    }
+}
@@ -0,0 +1,99 @@
+#include "RobotIndex.hpp"
+#include <cstring>
+
+constexpr std::size_t RobotIndex::kIdSize;
+
+namespace
+{
+    std::size_t roundUpPow2(std::size_t value)
+    {
+        std::size_t result = 2;
+        while (result < value)
+            result <<= 1;
+        return result;
+    }
+}
+
+RobotIndex::RobotIndex(std::size_t max_robots)
+    : capacity_(max_robots)
+    , ids_(max_robots * kIdSize, '\0')
+    , entries_(roundUpPow2(2 * max_robots))
+    , mask_(entries_.size() - 1)
+    , size_(0)
+{
+    for (auto& entry : entries_)
+        entry.store(kEmpty, std::memory_order_relaxed);
+}
+
+std::size_t RobotIndex::memoryBytes() const
+{
+    return ids_.size() + entries_.size() * sizeof(std::atomic<uint32_t>);
+}
+
+uint64_t RobotIndex::hashId(const char* id, std::size_t length)
+{
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+    for (std::size_t i = 0; i < length; i++)
+    {
+        hash ^= static_cast<unsigned char>(id[i]);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::size_t RobotIndex::find(const std::string& id) const
+{
+    if (id.empty() || id.size() >= kIdSize)
+        return capacity_;
+
+    return find(id.data(), id.size(), hashId(id.data(), id.size()));
+}
+
+std::size_t RobotIndex::find(const char* id, std::size_t length, uint64_t hash) const
+{
+    // linear probing; the table is at most half full, so an empty entry ends the search
+    for (std::size_t i = hash & mask_; ; i = (i + 1) & mask_)
+    {
+        uint32_t entry = entries_[i].load(std::memory_order_acquire);
+        if (entry == kEmpty)
+            return capacity_;
+
+        const char* known = this->id(entry - 1);
+        if (std::memcmp(known, id, length) == 0 && known[length] == '\0')
+            return entry - 1;
+    }
+}
+
+std::size_t RobotIndex::insert(const std::string& id)
+{
+    if (id.empty() || id.size() >= kIdSize)
+        return capacity_;
+
+    uint64_t hash = hashId(id.data(), id.size());
+    std::size_t found = find(id.data(), id.size(), hash);
+    if (found != capacity_)
+        return found;
+
+    std::lock_guard<std::mutex> lock(insert_mutex_);
+
+    // another thread may have added it meanwhile
+    found = find(id.data(), id.size(), hash);
+    if (found != capacity_)
+        return found;
+
+    std::size_t robot = size_.load(std::memory_order_relaxed);
+    if (robot == capacity_)
+        return capacity_;
+
+    std::memcpy(&ids_[robot * kIdSize], id.data(), id.size());
+
+    std::size_t i = hash & mask_;
+    while (entries_[i].load(std::memory_order_relaxed) != kEmpty)
+        i = (i + 1) & mask_;
+
+    // publish: readers that see the entry (or the new size) also see the id
+    entries_[i].store(static_cast<uint32_t>(robot + 1), std::memory_order_release);
+    size_.store(robot + 1, std::memory_order_release);
+    return robot;
+}
@@ -1,13 +1,63 @@
 #include "RobotPublisher.hpp"
+#include "AsyncLogger.hpp"
+#include "RobotTelemetryFastPubSubType.hpp"
+#include "TelemetryConversions.hpp"
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <algorithm>
 #include <iostream>
 
+namespace
+{
+    // called per failed write, so it goes through the async logger
+    void printWriteError(ReturnCode_t ret)
+    {
+        AsyncLogger& logger = AsyncLogger::instance();
+        logger.text(AsyncLogger::Category::PUBLISHER,
+                    "[Publisher] Error to public message! ReturnCode: " + std::to_string(ret));
+
+        // Debugging info
+        if (ret == RETCODE_ERROR)
+            logger.text(AsyncLogger::Category::PUBLISHER, "  -> RETCODE_ERROR: generic error");
+        else if (ret == RETCODE_BAD_PARAMETER)
+            logger.text(AsyncLogger::Category::PUBLISHER, "  -> RETCODE_BAD_PARAMETER: invalid parameter");
+        else if (ret == RETCODE_TIMEOUT)
+            logger.text(AsyncLogger::Category::PUBLISHER, "  -> RETCODE_TIMEOUT: Timeout");
+    }
+
+    const std::string& sampleId(const RobotTelemetry& sample)
+    {
+        return sample.id();
+    }
+
+    std::string sampleId(const RobotTelemetryPlain& sample)
+    {
+        return TelemetryConversions::plainId(sample);
+    }
+}
+
+const std::size_t RobotPublisher::kMaxBatchSamples;
+const std::size_t RobotPublisher::kDefaultBatchBytes;
+const std::size_t RobotPublisher::kMaxDeltaBatchBytes;
+
 RobotPublisher::RobotPublisher()
     :participant_(nullptr),
     publisher_(nullptr),
     topic_(nullptr),
     writer_(nullptr),
-    type_(new RobotTelemetryPubSubType()) 
+    writer_count_(1),
+    type_(new RobotTelemetryPubSubType()),
+    plain_(false),
+    compact_(false),
+    delta_matched_(0),
+    batch_(false),
+    batch_max_samples_(kMaxBatchSamples),
+    batch_max_bytes_(kDefaultBatchBytes),
+    batch_bytes_(0),
+    delta_batch_records_(0),
+    loan_checked_(false),
+    loan_supported_(false),
+    next_writer_(0),
+    verbose_(true)
 {
 }
 
@@ -16,34 +66,104 @@ RobotPublisher::~RobotPublisher()
     stop();
 }
 
+void RobotPublisher::setFastSerialization(bool enabled)
+{
+    if (enabled)
+        type_ = TypeSupport(new RobotTelemetryFastPubSubType());
+    else
+        type_ = TypeSupport(new RobotTelemetryPubSubType());
+}
+
 //bool RobotPublisher::init()
 bool RobotPublisher::init(const DataWriterQos& qos)
 {
-    std::cout << "[Publisher] Initializing ..." << std::endl;
+    return init(qos, PARTICIPANT_QOS_DEFAULT);
+}
+
+bool RobotPublisher::init(const DataWriterQos& qos, const DomainParticipantQos& pqos)
+{
+    return createEntities(topic_name_.empty() ? "robot_telemetry" : topic_name_, qos, pqos);
+}
+
+bool RobotPublisher::initPlain(const DataWriterQos& qos, const DomainParticipantQos& pqos)
+{
+    plain_ = true;
+    type_ = TypeSupport(new RobotTelemetryPlainPubSubType());
+
+    return createEntities(topic_name_.empty() ? "robot_telemetry_plain" : topic_name_, qos, pqos);
+}
+
+bool RobotPublisher::initCompact(const DataWriterQos& qos, const DomainParticipantQos& pqos)
+{
+    compact_ = true;
+    type_ = TypeSupport(new RobotTelemetryCompactPubSubType());
+
+    return createEntities(topic_name_.empty() ? "robot_telemetry_compact" : topic_name_, qos, pqos);
+}
+
+bool RobotPublisher::initDelta(const DataWriterQos& qos, uint32_t keyframe_interval, const DomainParticipantQos& pqos)
+{
+    delta_encoder_.reset(new TelemetryDeltaEncoder(keyframe_interval));
+    type_ = TypeSupport(new RobotTelemetryDeltaPubSubType());
+
+    return createEntities(topic_name_.empty() ? "robot_telemetry_delta" : topic_name_, qos, pqos);
+}
+
+bool RobotPublisher::initBatch(const DataWriterQos& qos, std::size_t max_samples, std::size_t max_bytes,
+                               const DomainParticipantQos& pqos)
+{
+    batch_ = true;
+    batch_max_samples_ = std::min(std::max<std::size_t>(max_samples, 1), kMaxBatchSamples);
+    batch_max_bytes_ = max_bytes;
+    batch_sample_.samples().reserve(batch_max_samples_);
+    type_ = TypeSupport(new RobotTelemetryBatchPubSubType());
+
+    return createEntities(topic_name_.empty() ? "robot_telemetry_batch" : topic_name_, qos, pqos);
+}
+
+bool RobotPublisher::initDeltaBatch(const DataWriterQos& qos, uint32_t keyframe_interval, std::size_t max_samples,
+                                    std::size_t max_bytes, const DomainParticipantQos& pqos)
+{
+    delta_encoder_.reset(new TelemetryDeltaEncoder(keyframe_interval));
+    batch_ = true;
+    batch_max_samples_ = std::min(std::max<std::size_t>(max_samples, 1), kMaxBatchSamples);
+    batch_max_bytes_ = std::min(max_bytes, kMaxDeltaBatchBytes);
+    delta_batch_sample_.records().reserve(kMaxDeltaBatchBytes);
+    type_ = TypeSupport(new RobotTelemetryDeltaBatchPubSubType());
+
+    return createEntities(topic_name_.empty() ? "robot_telemetry_delta_batch" : topic_name_, qos, pqos);
+}
+
+bool RobotPublisher::createEntities(const std::string& topic_name, const DataWriterQos& qos, const DomainParticipantQos& pqos)
+{
+    if (verbose_)
+        std::cout << "[Publisher] Initializing ..." << std::endl;
     
     //create Domain participant
-    DomainParticipantQos pqos;
-    pqos.name("RobotPublisher_Participant");
+    DomainParticipantQos participant_qos = pqos;
+    participant_qos.name("RobotPublisher_Participant");
 
     participant_ = DomainParticipantFactory::get_instance()->create_participant(
         0, // domain id
-        pqos // qos settings
+        participant_qos // qos settings
     );
 
     if(participant_ == nullptr){
         std::cerr<< "[Publisher] Error: Failed to create DomainParticipant!"<< std::endl;
         return false;
     }
-    std::cout<<"[Publisher] DomainParticipant created (Domain 0)" << std::endl;
+    if (verbose_)
+        std::cout<<"[Publisher] DomainParticipant created (Domain 0)" << std::endl;
 
     //register data type
     type_.register_type(participant_);
-    std::cout << "[Publisher] Datatype registered: " << type_.get_type_name();
+    if (verbose_)
+        std::cout << "[Publisher] Datatype registered: " << type_.get_type_name() << std::endl;
 
     //create topic
-    // topic = "robot_telemetry", type = RobotTelemetry
+    // topic = "robot_telemetry", type = RobotTelemetry (or the plain / compact / delta / batch / delta batch variant)
     topic_ = participant_->create_topic(
-        "robot_telemetry",
+        topic_name,
         type_.get_type_name(),
         TOPIC_QOS_DEFAULT); //change it later
 
@@ -51,7 +171,8 @@ bool RobotPublisher::init(const DataWriterQos& qos)
         std::cerr << "[Publisher] Error: Failed to create Topic!" << std::endl;
         return false;
     }
-    std::cout << "[Publisher] Topic created: robot_telemetry" << std::endl;
+    if (verbose_)
+        std::cout << "[Publisher] Topic created: " << topic_name << std::endl;
 
     //create publisher
     publisher_ = participant_->create_publisher(PUBLISHER_QOS_DEFAULT);
@@ -60,35 +181,78 @@ bool RobotPublisher::init(const DataWriterQos& qos)
         std::cerr << "[Publisher] Error: Failed to create Publisher!" << std::endl;
         return false;
     }
-    std::cout << "[Publisher] Publisher created" << std::endl;
+    if (verbose_)
+        std::cout << "[Publisher] Publisher created" << std::endl;
 
-    //create writer
-    writer_ = publisher_->create_datawriter(
-        topic_,                      // topic to write
-        qos,      // qos custom
-        &listener_);                 // listener for events 
+    //create writers: one, or writer_count_ sharing the listener
+    // a batch is keyless, there is nothing to shard
+    std::size_t count = batch_ ? 1 : writer_count_;
+    writers_.reserve(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        DataWriter* writer = publisher_->create_datawriter(
+            topic_,                      // topic to write
+            qos,      // qos custom
+            &listener_);                 // listener for events 
 
-    if (writer_ == nullptr)
+        if (writer == nullptr)
+        {
+            std::cerr << "[Publisher] Error: Failed to create DataWriter " << i << "!" << std::endl;
+            return false;
+        }
+        writers_.push_back(writer);
+    }
+    writer_ = writers_.front();
+
+    if (count > 1)
     {
-        std::cerr << "[Publisher] Error: Failed to create DataWriter!" << std::endl;
-        return false;
+        // a loan belongs to one writer, and the robot (so the writer) is only known once filled
+        loan_checked_ = true;
+        loan_supported_ = false;
     }
 
-    printWriterQoS(qos);
-    std::cout << "[Publisher] DataWriter created" << std::endl;
+    if (verbose_)
+    {
+        printWriterQoS(qos);
+        if (count > 1)
+            std::cout << "[Publisher] " << count << " DataWriters created, robots assigned round-robin" << std::endl;
+        else
+            std::cout << "[Publisher] DataWriter created" << std::endl;
+    }
 
     return true;
 }   
 
 bool RobotPublisher::publish(RobotTelemetry& data)
 {
+    if (plain_)
+    {
+        // a plain writer only accepts RobotTelemetryPlain
+        TelemetryConversions::toPlain(data, reuse_plain_sample_);
+        return publish(reuse_plain_sample_);
+    }
+
+    if (delta_encoder_ != nullptr)
+        return publishDelta(data);
+
+    if (batch_)
+        return publishBatched([&data](RobotTelemetry& record) { record = data; });
+
+    if (compact_)
+    {
+        // a compact writer only accepts RobotTelemetryCompact
+        TelemetryConversions::toCompact(data, reuse_compact_sample_);
+        return publish(reuse_compact_sample_);
+    }
+
     if (writer_ == nullptr)
     {
         std::cerr << "[Publisher] Error: writer is not initializated!" << std::endl;
         return false;
     }
 
-    ReturnCode_t ret = writer_->write(&data);
+    const Route& target = route(data.id(), &data);
+    ReturnCode_t ret = target.writer->write(&data, target.handle);
     
     if (ret == RETCODE_OK)
     {
@@ -96,24 +260,322 @@ bool RobotPublisher::publish(RobotTelemetry& data)
     }
     else
     {
-        std::cerr << "[Publisher] Error to public message! ReturnCode: " << ret << std::endl;
-        
-        // Debugging info
-        if (ret == RETCODE_ERROR)
-            std::cerr << "  -> RETCODE_ERROR: generic error" << std::endl;
-        else if (ret == RETCODE_BAD_PARAMETER)
-            std::cerr << "  -> RETCODE_BAD_PARAMETER: invalid parameter" << std::endl;
-        else if (ret == RETCODE_TIMEOUT)
-            std::cerr << "  -> RETCODE_TIMEOUT: Timeout" << std::endl;
-        
+        printWriteError(ret);
         return false;
     }
 }
 
+bool RobotPublisher::publish(RobotTelemetryPlain& data)
+{
+    if (writer_ == nullptr || !plain_)
+    {
+        std::cerr << "[Publisher] Error: plain writer is not initializated!" << std::endl;
+        return false;
+    }
+
+    const Route& target = route(sampleId(data), &data);
+    ReturnCode_t ret = target.writer->write(&data, target.handle);
+
+    if (ret == RETCODE_OK)
+    {
+        return true;
+    }
+    else
+    {
+        printWriteError(ret);
+        return false;
+    }
+}
+
+bool RobotPublisher::publish(RobotTelemetryCompact& data)
+{
+    if (writer_ == nullptr || !compact_)
+    {
+        std::cerr << "[Publisher] Error: compact writer is not initializated!" << std::endl;
+        return false;
+    }
+
+    const Route& target = route(data.id(), &data);
+    ReturnCode_t ret = target.writer->write(&data, target.handle);
+
+    if (ret == RETCODE_OK)
+    {
+        return true;
+    }
+    else
+    {
+        printWriteError(ret);
+        return false;
+    }
+}
+
+bool RobotPublisher::publishDelta(const RobotTelemetry& data)
+{
+    if (writer_ == nullptr)
+    {
+        std::cerr << "[Publisher] Error: delta writer is not initializated!" << std::endl;
+        return false;
+    }
+
+    // a reader that just matched can only start from a keyframe; total_count
+    // also catches one leaving and another joining between two publishes
+    int matched = listener_.total_matched_.load();
+    if (matched != delta_matched_)
+        delta_encoder_->requestKeyframes();
+    delta_matched_ = matched;
+
+    if (batch_)
+        return publishDeltaRecord(data);
+
+    reuse_delta_sample_.id(data.id());
+    delta_encoder_->encode(data, reuse_delta_sample_.frame());
+
+    const Route& target = route(data.id(), &reuse_delta_sample_);
+    ReturnCode_t ret = target.writer->write(&reuse_delta_sample_, target.handle);
+
+    if (ret == RETCODE_OK)
+    {
+        return true;
+    }
+    else
+    {
+        printWriteError(ret);
+        return false;
+    }
+}
+
+bool RobotPublisher::publishBatched(const std::function<void(RobotTelemetry&)>& fill)
+{
+    if (writer_ == nullptr)
+    {
+        std::cerr << "[Publisher] Error: batch writer is not initializated!" << std::endl;
+        return false;
+    }
+
+    // the record is filled in place, in the batch
+    std::vector<RobotTelemetry>& records = batch_sample_.samples();
+    records.emplace_back();
+    fill(records.back());
+
+    // minus the encapsulation, plus the alignment before the record
+    std::size_t size = record_type_.calculate_serialized_size(
+        &records.back(), DataRepresentationId_t::XCDR2_DATA_REPRESENTATION) - 4 + 3;
+
+    bool ok = true;
+    if (records.size() > 1 && batch_bytes_ + size > batch_max_bytes_)
+    {
+        // over the byte budget: the new record opens the next batch
+        RobotTelemetry record = std::move(records.back());
+        records.pop_back();
+        ok = writeBatch();
+        records.push_back(std::move(record));
+    }
+
+    batch_bytes_ += size;
+    if (records.size() >= batch_max_samples_)
+        ok = writeBatch() && ok;
+
+    return ok;
+}
+
+bool RobotPublisher::publishDeltaRecord(const RobotTelemetry& data)
+{
+    std::vector<uint8_t>& records = delta_batch_sample_.records();
+    std::size_t start = records.size();
+    delta_encoder_->encodeRecord(data, records);
+
+    bool ok = true;
+    if (delta_batch_records_ > 0 && records.size() > batch_max_bytes_)
+    {
+        // over the byte budget: the new record opens the next batch
+        std::vector<uint8_t> record(records.begin() + start, records.end());
+        records.resize(start);
+        ok = writeBatch();
+        records.assign(record.begin(), record.end());
+    }
+
+    delta_batch_records_++;
+    if (delta_batch_records_ >= batch_max_samples_)
+        ok = writeBatch() && ok;
+
+    return ok;
+}
+
+bool RobotPublisher::flush()
+{
+    if (!batch_ || writer_ == nullptr)
+        return true;
+
+    return writeBatch();
+}
+
+bool RobotPublisher::writeBatch()
+{
+    ReturnCode_t ret;
+    if (delta_encoder_ != nullptr)
+    {
+        if (delta_batch_records_ == 0)
+            return true;
+
+        // keyless type: no instance handle
+        ret = writer_->write(&delta_batch_sample_);
+        delta_batch_sample_.records().clear();
+        delta_batch_records_ = 0;
+    }
+    else
+    {
+        if (batch_sample_.samples().empty())
+            return true;
+
+        ret = writer_->write(&batch_sample_);
+        batch_sample_.samples().clear();
+        batch_bytes_ = 0;
+    }
+
+    if (ret == RETCODE_OK)
+    {
+        return true;
+    }
+    else
+    {
+        printWriteError(ret);
+        return false;
+    }
+}
+
+bool RobotPublisher::publishLoaned(const std::function<void(RobotTelemetry&)>& fill)
+{
+    if (batch_ && delta_encoder_ == nullptr)
+        return publishBatched(fill);
+
+    if (plain_ || compact_ || delta_encoder_ != nullptr)
+    {
+        fill(reuse_sample_);
+        return publish(reuse_sample_);
+    }
+
+    return publishLoanedSample(fill, reuse_sample_);
+}
+
+bool RobotPublisher::publishPlain(const std::function<void(RobotTelemetryPlain&)>& fill)
+{
+    if (!plain_)
+    {
+        std::cerr << "[Publisher] Error: publishPlain needs a writer created with initPlain!" << std::endl;
+        return false;
+    }
+
+    return publishLoanedSample(fill, reuse_plain_sample_);
+}
+
+template<typename T>
+bool RobotPublisher::publishLoanedSample(const std::function<void(T&)>& fill, T& reuse_sample)
+{
+    if (writer_ == nullptr)
+    {
+        std::cerr << "[Publisher] Error: writer is not initializated!" << std::endl;
+        return false;
+    }
+
+    if (loan_checked_ && !loan_supported_)
+    {
+        fill(reuse_sample);
+        return publish(reuse_sample);
+    }
+
+    void* sample = nullptr;
+    ReturnCode_t ret = writer_->loan_sample(sample);
+
+    if (!loan_checked_)
+    {
+        loan_checked_ = true;
+        loan_supported_ = (ret == RETCODE_OK);
+        if (!loan_supported_)
+        {
+            if (verbose_)
+                std::cout << "[Publisher] loan_sample not available for " << type_.get_type_name()
+                          << " (ReturnCode: " << ret << "), reusing one sample instead" << std::endl;
+            fill(reuse_sample);
+            return publish(reuse_sample);
+        }
+    }
+
+    if (ret != RETCODE_OK)
+    {
+        AsyncLogger::instance().text(AsyncLogger::Category::PUBLISHER,
+                                     "[Publisher] Error to loan sample! ReturnCode: " + std::to_string(ret));
+        return false;
+    }
+
+    T& loaned = *static_cast<T*>(sample);
+    fill(loaned);
+
+    // on success the writer takes the loan back
+    // only one writer here: see createEntities()
+    ret = writer_->write(sample, route(sampleId(loaned), sample).handle);
+    if (ret != RETCODE_OK)
+    {
+        AsyncLogger::instance().text(AsyncLogger::Category::PUBLISHER,
+                                     "[Publisher] Error to public loaned message! ReturnCode: " + std::to_string(ret));
+        writer_->discard_loan(sample);
+        return false;
+    }
+
+    return true;
+}
+
+const RobotPublisher::Route& RobotPublisher::route(const std::string& id, const void* sample)
+{
+    auto it = routes_.find(id);
+    if (it != routes_.end())
+        return it->second;
+
+    // first sample of this robot: it gets a writer for good, and the key is hashed once, here
+    Route route;
+    route.writer = writers_[next_writer_];
+    next_writer_ = (next_writer_ + 1) % writers_.size();
+    route.handle = route.writer->register_instance(sample);
+    if (!route.handle.isDefined())
+    {
+        // write() will compute the key itself
+        std::cerr << "[Publisher] Warning: failed to register instance " << id << std::endl;
+    }
+
+    return routes_.emplace(id, route).first->second;
+}
+
+void RobotPublisher::setVerbose(bool verbose)
+{
+    verbose_ = verbose;
+    listener_.setVerbose(verbose);
+}
+
+void RobotPublisher::setWriterCount(std::size_t count)
+{
+    writer_count_ = std::max<std::size_t>(count, 1);
+}
+
+std::size_t RobotPublisher::getMatchedWriters() const
+{
+    std::size_t matched = 0;
+    for (DataWriter* writer : writers_)
+    {
+        PublicationMatchedStatus status;
+        if (writer->get_publication_matched_status(status) == RETCODE_OK && status.current_count > 0)
+            matched++;
+    }
+    return matched;
+}
+
 //get num of subscribers
 int RobotPublisher::getMatchedSubscribers() const
 {
-    return listener_.matched_;
+    return listener_.matched_.load();
+}
+
+bool RobotPublisher::waitForMatch(int timeout_ms, int count)
+{
+    return listener_.waitForMatch(count, std::chrono::milliseconds(timeout_ms));
 }
 
 void RobotPublisher::stop()
@@ -123,10 +585,16 @@ void RobotPublisher::stop()
         // Șterge în ordine inversă creării
         if (publisher_ != nullptr)
         {
-            if (writer_ != nullptr)
+            if (!writers_.empty())
             {
-                publisher_->delete_datawriter(writer_);
+                // records queued in batch mode
+                flush();
+                for (DataWriter* writer : writers_)
+                    publisher_->delete_datawriter(writer);
+                writers_.clear();
                 writer_ = nullptr;
+                routes_.clear();
+                next_writer_ = 0;
             }
             participant_->delete_publisher(publisher_);
             publisher_ = nullptr;
@@ -141,7 +609,8 @@ void RobotPublisher::stop()
         DomainParticipantFactory::get_instance()->delete_participant(participant_);
         participant_ = nullptr;
 
-        std::cout << "[Publisher] Oprit și curățat" << std::endl;
+        if (verbose_)
+            std::cout << "[Publisher] Oprit și curățat" << std::endl;
     }
 }
 
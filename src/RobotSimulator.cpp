@@ -1,4 +1,6 @@
 #include "RobotSimulator.hpp"
+#include "RobotModels.hpp"
+#include "TelemetryConversions.hpp"
 #include <cmath>
 #include <chrono>
 
@@ -50,96 +52,45 @@ void RobotSimulator::update(double dt)
 void RobotSimulator::updateCircularMotion(double dt)
 {    
     double angle = angular_velocity_ * time_;
-    
-    x_ = circle_center_x_ + circle_radius_ * std::cos(angle);
-    y_ = circle_center_y_ + circle_radius_ * std::sin(angle);
-    
-    orientation_ = angle + M_PI / 2.0; 
-    
-    while (orientation_ > 2 * M_PI)
-        orientation_ -= 2 * M_PI;
-    while (orientation_ < 0)
-        orientation_ += 2 * M_PI;
-    
-    velocity_ = circle_radius_ * std::abs(angular_velocity_);
+
+    RobotModels::circularStep(angle, circle_center_x_, circle_center_y_,
+                              circle_radius_, angular_velocity_,
+                              x_, y_, orientation_, velocity_);
 }
 
 void RobotSimulator::updateLinearMotion(double dt)
 {
-
-    x_ += velocity_ * std::cos(motion_angle_) * dt;
-    y_ += velocity_ * std::sin(motion_angle_) * dt;
-    
-    orientation_ = motion_angle_;
+    RobotModels::linearStep(velocity_ * std::cos(motion_angle_),
+                            velocity_ * std::sin(motion_angle_),
+                            motion_angle_, dt, x_, y_, orientation_);
 }
 
 void RobotSimulator::updateBattery(double dt)
 {
-    if (is_charging_)
-    {
-        //charging
-        battery_level_ += battery_charge_rate_ * dt;
-        
-        if (battery_level_ >= 100.0f)
-        {
-            battery_level_ = 100.0f;
-            is_charging_ = false; 
-        }
-    }
-    else
-    {
-        //discharge only if robot is moving
-        if (motion_mode_ != MotionMode::STATIONARY && velocity_ > 0.0)
-        {
-            battery_level_ -= battery_drain_rate_ * dt;
-            
-            if (battery_level_ <= 0.0f)
-            {
-                battery_level_ = 0.0f;
-                is_charging_ = true; 
-            }
-        }
-    }
+    bool moving = motion_mode_ != MotionMode::STATIONARY && velocity_ > 0.0;
+
+    RobotModels::batteryStep(dt, moving, battery_drain_rate_, battery_charge_rate_,
+                             battery_level_, is_charging_);
 }
 
-std::string RobotSimulator::determineStatus() const
+RobotStatus RobotSimulator::determineStatus() const
 {
-    // Priority: CHARGING > LOW_BATTERY > moving module
-    
-    if (is_charging_)
-    {
-        return "CHARGING";
-    }
-    
-    if (battery_level_ <= low_battery_threshold_ && battery_level_ > 0.0f)
-    {
-        return "LOW_BATTERY";
-    }
-    
-    if (battery_level_ <= 0.0f)
-    {
-        return "DISCHARGED";
-    }
-    
-    switch (motion_mode_)
-    {
-        case MotionMode::CIRCULAR:
-        case MotionMode::LINEAR:
-            return (velocity_ > 0.0) ? "MOVING" : "IDLE";
-        
-        case MotionMode::STATIONARY:
-            return "IDLE";
-        
-        default:
-            return "UNKNOWN";
-    }
+    bool moving = motion_mode_ != MotionMode::STATIONARY && velocity_ > 0.0;
+
+    return RobotModels::status(is_charging_, battery_level_, low_battery_threshold_, moving);
 }
 
 RobotTelemetry RobotSimulator::generateTelemetry()
 {
     RobotTelemetry telemetry;
-    
-    telemetry.id(robot_id_);
+    fillTelemetry(telemetry);
+    return telemetry;
+}
+
+void RobotSimulator::fillTelemetry(RobotTelemetry& telemetry) const
+{
+    // assign() reuses the string capacity the sample already has
+    telemetry.id().assign(robot_id_);
     telemetry.x(x_);
     telemetry.y(y_);
     telemetry.orientation(orientation_);
@@ -151,8 +102,20 @@ RobotTelemetry RobotSimulator::generateTelemetry()
     auto duration = now.time_since_epoch();
     uint64_t timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
     telemetry.timestamp(timestamp_ns);
-    
-    return telemetry;
+}
+
+void RobotSimulator::fillTelemetry(RobotTelemetryPlain& telemetry) const
+{
+    TelemetryConversions::setPlainId(telemetry, robot_id_);
+    telemetry.x(x_);
+    telemetry.y(y_);
+    telemetry.orientation(orientation_);
+    telemetry.speed(velocity_);
+    telemetry.battery_level(battery_level_);
+    telemetry.status(determineStatus());
+
+    auto now = std::chrono::system_clock::now();
+    telemetry.timestamp(std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count());
 }
 
 void RobotSimulator::setCircularMotion(double radius, double angular_velocity)
@@ -0,0 +1,125 @@
+#include "RobotStateStore.hpp"
+#include <cstddef>
+#include <cstring>
+
+constexpr std::size_t RobotStateStore::kIdSize;
+constexpr std::size_t RobotStateStore::kValuesOffset;
+constexpr std::size_t RobotStateStore::kValueWords;
+
+static_assert(offsetof(RobotStateStore::RobotState, x) == RobotStateStore::kIdSize,
+              "the values must start right after the id");
+static_assert(sizeof(RobotStateStore::RobotState) == RobotStateStore::kIdSize + 8 * sizeof(uint64_t),
+              "RobotState must have no padding");
+
+namespace
+{
+    const std::size_t kUpdatesWord =
+        (offsetof(RobotStateStore::RobotState, updates) - RobotStateStore::kIdSize) / sizeof(uint64_t);
+}
+
+RobotStateStore::RobotStateStore(std::size_t max_robots)
+    : index_(max_robots)
+    , slots_(max_robots)
+    , rejected_(0)
+{
+    for (Slot& slot : slots_)
+    {
+        slot.sequence.store(0, std::memory_order_relaxed);
+        for (auto& value : slot.values)
+            value.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::size_t RobotStateStore::memoryBytes() const
+{
+    return slots_.size() * sizeof(Slot) + index_.memoryBytes();
+}
+
+bool RobotStateStore::update(const RobotTelemetry& telemetry, int64_t source_timestamp)
+{
+    std::size_t robot = index_.insert(telemetry.id());
+    if (robot == index_.capacity())
+    {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    write(slots_[robot], telemetry, source_timestamp);
+    return true;
+}
+
+bool RobotStateStore::get(const std::string& id, RobotState& state) const
+{
+    std::size_t robot = index_.find(id);
+    if (robot == index_.capacity())
+        return false;
+
+    read(robot, state);
+    return true;
+}
+
+std::size_t RobotStateStore::snapshot(std::vector<RobotState>& states) const
+{
+    std::size_t count = index_.size();
+    states.resize(count);
+
+    for (std::size_t i = 0; i < count; i++)
+        read(i, states[i]);
+
+    return count;
+}
+
+void RobotStateStore::write(Slot& slot, const RobotTelemetry& telemetry, int64_t source_timestamp)
+{
+    // seqlock writer: even -> odd (a CAS, so several ingest threads may share the store)
+    uint32_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    while ((sequence & 1) != 0
+           || !slot.sequence.compare_exchange_weak(sequence, sequence + 1,
+                                                   std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        sequence = slot.sequence.load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    RobotState state;
+    state.x = telemetry.x();
+    state.y = telemetry.y();
+    state.orientation = telemetry.orientation();
+    state.speed = telemetry.speed();
+    state.timestamp = telemetry.timestamp();
+    state.battery_level = telemetry.battery_level();
+    state.status = telemetry.status();
+    state.source_timestamp = source_timestamp;
+    state.updates = slot.values[kUpdatesWord].load(std::memory_order_relaxed) + 1;
+
+    uint64_t values[kValueWords];
+    std::memcpy(values, reinterpret_cast<const char*>(&state) + kValuesOffset, sizeof(values));
+    for (std::size_t i = 0; i < kValueWords; i++)
+        slot.values[i].store(values[i], std::memory_order_relaxed);
+
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+void RobotStateStore::read(std::size_t robot, RobotState& state) const
+{
+    const Slot& slot = slots_[robot];
+
+    // seqlock reader: retry if a write was in progress or happened during the copy
+    uint64_t values[kValueWords];
+    while (true)
+    {
+        uint32_t before = slot.sequence.load(std::memory_order_acquire);
+        if ((before & 1) != 0)
+            continue;
+
+        for (std::size_t i = 0; i < kValueWords; i++)
+            values[i] = slot.values[i].load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) == before)
+            break;
+    }
+
+    std::memcpy(state.id, index_.id(robot), kIdSize);
+    std::memcpy(reinterpret_cast<char*>(&state) + kValuesOffset, values, sizeof(values));
+}
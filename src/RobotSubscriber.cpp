@@ -1,14 +1,30 @@
 #include "RobotSubscriber.hpp"
+#include "TelemetryConversions.hpp"
+#include "RobotTelemetryFastPubSubType.hpp"
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <chrono>
 #include <iostream>
 #include <iomanip>
 
+namespace
+{
+    // pause before the WaitSet thread reads again after an error
+    const int kReadRetryMs = 10;
+}
+
 RobotSubscriber::RobotSubscriber()
     : participant_(nullptr)
     , subscriber_(nullptr)
     , topic_(nullptr)
     , reader_(nullptr)
     , type_(new RobotTelemetryPubSubType())
+    , read_mode_(ReadMode::LISTENER)
+    , max_batch_(256)
+    , plain_(false)
+    , compact_(false)
+    , batch_(false)
+    , reader_running_(false)
+    , read_errors_(0)
 {
 }
 
@@ -17,10 +33,109 @@ RobotSubscriber::~RobotSubscriber()
     stop();
 }
 
+void RobotSubscriber::setFastSerialization(bool enabled)
+{
+    if (enabled)
+        type_ = TypeSupport(new RobotTelemetryFastPubSubType());
+    else
+        type_ = TypeSupport(new RobotTelemetryPubSubType());
+}
+
+void RobotSubscriber::enableStateStore(std::size_t max_robots)
+{
+    state_store_.reset(new RobotStateStore(max_robots));
+    listener_.setStateStore(state_store_.get());
+}
+
+void RobotSubscriber::enableHistory(const TelemetryHistory::Config& config)
+{
+    history_.reset(new TelemetryHistory(config));
+    listener_.setHistory(history_.get());
+}
+
+bool RobotSubscriber::enableRecorder(const TelemetryRecorder::Config& config)
+{
+    std::unique_ptr<TelemetryRecorder> recorder(new TelemetryRecorder());
+    if (!recorder->start(config))
+    {
+        std::cerr << "[Subscriber] Error: Failed to start the recorder in " << config.directory << std::endl;
+        return false;
+    }
+
+    recorder_ = std::move(recorder);
+    listener_.setRecorder(recorder_.get());
+    return true;
+}
+
+void RobotSubscriber::enableLatencyTracking(const std::string& profile, std::size_t max_robots, int report_interval_ms)
+{
+    latency_.reset(new LatencyTracker(profile, max_robots));
+    listener_.setLatencyTracker(latency_.get());
+
+    if (report_interval_ms > 0)
+        latency_->startReporting(report_interval_ms);
+}
+
 bool RobotSubscriber::init(DataReaderQos& qos)
+{
+    return init(qos, PARTICIPANT_QOS_DEFAULT);
+}
+
+bool RobotSubscriber::init(const DataReaderQos& qos, const DomainParticipantQos& pqos)
+{
+    return createEntities(topic_name_.empty() ? "robot_telemetry" : topic_name_, qos, pqos);
+}
+
+bool RobotSubscriber::initPlain(const DataReaderQos& qos, const DomainParticipantQos& pqos)
+{
+    type_ = TypeSupport(new RobotTelemetryPlainPubSubType());
+    listener_.setPlain(true);
+    plain_ = true;
+
+    return createEntities(topic_name_.empty() ? "robot_telemetry_plain" : topic_name_, qos, pqos);
+}
+
+bool RobotSubscriber::initCompact(const DataReaderQos& qos, const DomainParticipantQos& pqos)
+{
+    type_ = TypeSupport(new RobotTelemetryCompactPubSubType());
+    listener_.setCompact(true);
+    compact_ = true;
+
+    return createEntities(topic_name_.empty() ? "robot_telemetry_compact" : topic_name_, qos, pqos);
+}
+
+bool RobotSubscriber::initDelta(const DataReaderQos& qos, const DomainParticipantQos& pqos)
+{
+    type_ = TypeSupport(new RobotTelemetryDeltaPubSubType());
+    delta_decoder_.reset(new TelemetryDeltaDecoder());
+    listener_.setDeltaDecoder(delta_decoder_.get());
+
+    return createEntities(topic_name_.empty() ? "robot_telemetry_delta" : topic_name_, qos, pqos);
+}
+
+bool RobotSubscriber::initBatch(const DataReaderQos& qos, const DomainParticipantQos& pqos)
+{
+    type_ = TypeSupport(new RobotTelemetryBatchPubSubType());
+    listener_.setBatch(true);
+    batch_ = true;
+
+    return createEntities(topic_name_.empty() ? "robot_telemetry_batch" : topic_name_, qos, pqos);
+}
+
+bool RobotSubscriber::initDeltaBatch(const DataReaderQos& qos, const DomainParticipantQos& pqos)
+{
+    type_ = TypeSupport(new RobotTelemetryDeltaBatchPubSubType());
+    delta_decoder_.reset(new TelemetryDeltaDecoder());
+    listener_.setDeltaDecoder(delta_decoder_.get());
+    listener_.setBatch(true);
+    batch_ = true;
+
+    return createEntities(topic_name_.empty() ? "robot_telemetry_delta_batch" : topic_name_, qos, pqos);
+}
+
+bool RobotSubscriber::createEntities(const std::string& topic_name, const DataReaderQos& qos, const DomainParticipantQos& pqos)
 {
     std::cout << "[Subscriber] Initializing...\n" << std::endl;
-    DomainParticipantQos pqos;
 
     participant_ = DomainParticipantFactory::get_instance()->create_participant(0, pqos);
 
@@ -37,7 +152,7 @@ bool RobotSubscriber::init(DataReaderQos& qos)
 
     //create topic - same name as publisher
     topic_ = participant_->create_topic(
-        "robot_telemetry",
+        topic_name,
         type_.get_type_name(),
         TOPIC_QOS_DEFAULT
     );
@@ -46,7 +161,7 @@ bool RobotSubscriber::init(DataReaderQos& qos)
         std::cerr << "[Subscriber] Error: Failed to create Topic!" << std::endl;
         return false;
     }
-    std::cout << "[Subscriber] Topic created: robot_telemetry" << std::endl;
+    std::cout << "[Subscriber] Topic created: " << topic_name << std::endl;
 
     //create subscriber
     subscriber_ = participant_->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
@@ -59,10 +174,16 @@ bool RobotSubscriber::init(DataReaderQos& qos)
     std::cout << "[Subscriber] Subscriber created" << std::endl;
 
     //create data reader
+    // in WAITSET mode the listener only tracks matching, data is read by reader_thread_
+    StatusMask mask = read_mode_ == ReadMode::WAITSET
+        ? StatusMask::subscription_matched()
+        : StatusMask::all();
+
     reader_ = subscriber_->create_datareader(
         topic_,
         qos,
-        &listener_);
+        &listener_,
+        mask);
 
     if(reader_ == nullptr) {
         std::cerr<<"[Subscriber] Error: Failed to create datareader" << std::endl;
@@ -72,9 +193,145 @@ bool RobotSubscriber::init(DataReaderQos& qos)
     printReaderQoS(reader_->get_qos());
     std::cout << "[Subscriber] Datareader created!" << std::endl;
 
+    if (read_mode_ == ReadMode::WAITSET)
+    {
+        stop_condition_.set_trigger_value(false);
+        reader_running_ = true;
+        reader_thread_ = std::thread(&RobotSubscriber::readerLoop, this);
+        std::cout << "[Subscriber] WaitSet reader thread started (batch " << max_batch_ << ")" << std::endl;
+    }
+
     return true;
 }
 
+void RobotSubscriber::readerLoop()
+{
+    StatusCondition& data_condition = reader_->get_statuscondition();
+    data_condition.set_enabled_statuses(StatusMask::data_available());
+
+    WaitSet wait_set;
+    wait_set.attach_condition(data_condition);
+    wait_set.attach_condition(stop_condition_);
+
+    ConditionSeq active;
+    while (!stop_condition_.get_trigger_value())
+    {
+        active.clear();
+        ReturnCode_t ret = wait_set.wait(active, eprosima::fastdds::dds::Duration_t(1, 0));
+        if (ret == RETCODE_TIMEOUT)
+            continue;
+
+        if (stop_condition_.get_trigger_value())
+            break;
+
+        bool ok = ret == RETCODE_OK &&
+                 (plain_ ? drainReader<RobotTelemetryPlain>()
+                : compact_ ? drainReader<RobotTelemetryCompact>()
+                : delta_decoder_ && batch_ ? drainReader<RobotTelemetryDeltaBatch>()
+                : delta_decoder_ ? drainReader<RobotTelemetryDelta>()
+                : batch_ ? drainReader<RobotTelemetryBatch>()
+                : drainReader<RobotTelemetry>());
+        if (!ok)
+        {
+            // transient (e.g. out of loans while the consumers catch up): keep
+            // reading after a short pause instead of losing the thread
+            uint64_t errors = ++read_errors_;
+            if (ret != RETCODE_OK)
+                AsyncLogger::instance().text(AsyncLogger::Category::SUBSCRIBER,
+                                             "[Subscriber] WaitSet wait failed! ReturnCode: " + std::to_string(ret)
+                                             + " (" + std::to_string(errors) + " read errors)");
+            std::this_thread::sleep_for(std::chrono::milliseconds(kReadRetryMs));
+        }
+    }
+
+    wait_set.detach_condition(stop_condition_);
+    wait_set.detach_condition(data_condition);
+    reader_running_ = false;
+}
+
+namespace
+{
+    // nullptr: nothing to deliver for this sample (delta frame before a keyframe)
+    const RobotTelemetry* toTelemetry(const RobotTelemetry& sample, RobotTelemetry&, TelemetryDeltaDecoder*)
+    {
+        return &sample;
+    }
+
+    const RobotTelemetry* toTelemetry(const RobotTelemetryPlain& sample, RobotTelemetry& scratch, TelemetryDeltaDecoder*)
+    {
+        TelemetryConversions::fromPlain(sample, scratch);
+        return &scratch;
+    }
+
+    const RobotTelemetry* toTelemetry(const RobotTelemetryCompact& sample, RobotTelemetry& scratch, TelemetryDeltaDecoder*)
+    {
+        TelemetryConversions::fromCompact(sample, scratch);
+        return &scratch;
+    }
+
+    const RobotTelemetry* toTelemetry(const RobotTelemetryDelta& sample, RobotTelemetry& scratch,
+                                      TelemetryDeltaDecoder* decoder)
+    {
+        return decoder->decode(sample.id(), sample.frame(), scratch) ? &scratch : nullptr;
+    }
+
+    template<typename T>
+    void deliver(SubListener& listener, const T& sample, const SampleInfo& info, RobotTelemetry& scratch,
+                 TelemetryDeltaDecoder* decoder)
+    {
+        const RobotTelemetry* telemetry = toTelemetry(sample, scratch, decoder);
+        if (telemetry != nullptr)
+            listener.handleSample(*telemetry, info);
+    }
+
+    // a batch carries many robots
+    void deliver(SubListener& listener, const RobotTelemetryBatch& sample, const SampleInfo& info, RobotTelemetry&,
+                 TelemetryDeltaDecoder*)
+    {
+        listener.handleBatch(sample, info);
+    }
+
+    void deliver(SubListener& listener, const RobotTelemetryDeltaBatch& sample, const SampleInfo& info, RobotTelemetry&,
+                 TelemetryDeltaDecoder*)
+    {
+        listener.handleDeltaBatch(sample, info);
+    }
+}
+
+template<typename T>
+bool RobotSubscriber::drainReader()
+{
+    LoanableSequence<T> samples;
+    SampleInfoSeq infos;
+    RobotTelemetry scratch;
+
+    while (true)
+    {
+        ReturnCode_t ret = reader_->take(samples, infos, max_batch_);
+        if (ret == RETCODE_NO_DATA)
+            return true;
+
+        if (ret != RETCODE_OK)
+        {
+            AsyncLogger::instance().text(AsyncLogger::Category::SUBSCRIBER,
+                                         "[Subscriber] Eroare la citirea datelor! ReturnCode: " + std::to_string(ret)
+                                         + " (" + std::to_string(read_errors_.load() + 1) + " read errors)");
+            return false;
+        }
+
+        // the samples still live in the reader's history (or the data-sharing segment)
+        for (LoanableCollection::size_type i = 0; i < samples.length(); i++)
+        {
+            if (!infos[i].valid_data)
+                continue;
+
+            deliver(listener_, samples[i], infos[i], scratch, delta_decoder_.get());
+        }
+
+        reader_->return_loan(samples, infos);
+    }
+}
+
 void RobotSubscriber::run()
 {
     std::cout << "[Subscriber] Reading messages" << std::endl;
@@ -85,7 +342,7 @@ void RobotSubscriber::run()
 
 int RobotSubscriber::getMatchedPublishers() const
 {
-    return listener_.matched_;
+    return listener_.matched_.load();
 }
 
 uint32_t RobotSubscriber::getTotalMessages() const
@@ -95,6 +352,12 @@ uint32_t RobotSubscriber::getTotalMessages() const
 
 void RobotSubscriber::stop()
 {
+    if (reader_thread_.joinable())
+    {
+        stop_condition_.set_trigger_value(true);
+        reader_thread_.join();
+    }
+
     if (participant_ != nullptr)
     {
         // Șterge în ordine inversă creării
@@ -104,6 +367,12 @@ void RobotSubscriber::stop()
             {
                 subscriber_->delete_datareader(reader_);
                 reader_ = nullptr;
+
+                if (delta_decoder_)
+                    std::cout << "[Subscriber] Delta stream: " << delta_decoder_->getKeyframes() << " keyframes, "
+                              << delta_decoder_->getDeltas() << " deltas, " << delta_decoder_->getSkipped()
+                              << " skipped waiting for a keyframe (" << delta_decoder_->getGaps() << " gaps, "
+                              << delta_decoder_->getMalformed() << " malformed)" << std::endl;
             }
             participant_->delete_subscriber(subscriber_);
             subscriber_ = nullptr;
@@ -114,12 +383,24 @@ void RobotSubscriber::stop()
             participant_->delete_topic(topic_);
             topic_ = nullptr;
         }
-    }
 
-    DomainParticipantFactory::get_instance()->delete_participant(participant_);
-    participant_ = nullptr;
+        DomainParticipantFactory::get_instance()->delete_participant(participant_);
+        participant_ = nullptr;
 
-    std::cout<<"[Subscriber] Stopped" << std::endl;
+        // no more samples once the reader is gone; stop() also runs from the
+        // destructor, so this only happens on the first call
+        if (recorder_)
+            recorder_->stop();
+
+        if (latency_)
+        {
+            latency_->stopReporting();
+            if (latency_->getProfileHistogram().getCount() > 0)
+                latency_->report(std::cout, 5);
+        }
+
+        std::cout<<"[Subscriber] Stopped" << std::endl;
+    }
 }
 
 void RobotSubscriber::printReaderQoS(const DataReaderQos& qos)
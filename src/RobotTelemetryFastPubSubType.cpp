@@ -0,0 +1,289 @@
+#include "RobotTelemetryFastPubSubType.hpp"
+#include <fastdds/rtps/common/CdrSerialization.hpp>
+#include <cstddef>
+#include <cstring>
+
+using SerializedPayload_t = eprosima::fastdds::rtps::SerializedPayload_t;
+using InstanceHandle_t = eprosima::fastdds::rtps::InstanceHandle_t;
+using DataRepresentationId_t = eprosima::fastdds::dds::DataRepresentationId_t;
+
+const uint32_t RobotTelemetryFastPubSubType::kMaxFastIdLength;
+
+namespace
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    const bool kLittleEndian = true;
+#else
+    const bool kLittleEndian = false;
+#endif
+
+    // encapsulation header: {0, kind | endianness, options = {0, 0}}
+    const uint32_t kEncapsulationSize = 4;
+    const uint8_t kPlainCdrLe = 0x01;        // XCDRv1, PLAIN_CDR
+    const uint8_t kDelimitCdr2Le = 0x09;     // XCDRv2, DELIMIT_CDR2 (DHEADER + members)
+
+    // the members after the id, as Fast CDR aligns them:
+    // XCDRv1 aligns 8-byte types to 8, XCDRv2 to 4
+    struct NumericBlockV1
+    {
+        alignas(8) double x;
+        alignas(8) double y;
+        alignas(8) double orientation;
+        float battery_level;
+        alignas(8) double speed;
+        uint32_t status;
+        alignas(8) uint64_t timestamp;
+    };
+
+#pragma pack(push, 4)
+    struct NumericBlockV2
+    {
+        double x;
+        double y;
+        double orientation;
+        float battery_level;
+        double speed;
+        uint32_t status;
+        uint64_t timestamp;
+    };
+#pragma pack(pop)
+
+    static_assert(offsetof(NumericBlockV1, speed) == 32 && offsetof(NumericBlockV1, timestamp) == 48 &&
+                  sizeof(NumericBlockV1) == 56, "XCDRv1 layout");
+    static_assert(offsetof(NumericBlockV2, speed) == 28 && offsetof(NumericBlockV2, timestamp) == 40 &&
+                  sizeof(NumericBlockV2) == 48, "XCDRv2 layout");
+
+    // byte offsets inside the payload, for an id of `id_size` bytes ('\0' included)
+    struct Layout
+    {
+        bool xcdr2;
+        uint32_t id_size;            // characters + '\0'
+        uint32_t id_length_offset;   // uint32 string length
+        uint32_t numeric_offset;
+        uint32_t size;               // whole payload
+    };
+
+    uint32_t alignUp(uint32_t offset, uint32_t alignment)
+    {
+        return (offset + alignment - 1) & ~(alignment - 1);
+    }
+
+    // alignment is relative to the end of the encapsulation header
+    Layout makeLayout(bool xcdr2, uint32_t id_size)
+    {
+        Layout layout;
+        layout.xcdr2 = xcdr2;
+        layout.id_size = id_size;
+        layout.id_length_offset = xcdr2 ? 4 : 0;
+        uint32_t id_end = layout.id_length_offset + 4 + id_size;
+        layout.numeric_offset = alignUp(id_end, xcdr2 ? 4 : 8);
+        uint32_t body = layout.numeric_offset + (xcdr2 ? sizeof(NumericBlockV2) : sizeof(NumericBlockV1));
+
+        layout.id_length_offset += kEncapsulationSize;
+        layout.numeric_offset += kEncapsulationSize;
+        layout.size = kEncapsulationSize + body;
+        return layout;
+    }
+
+    template<typename Block>
+    void fillBlock(const RobotTelemetry& sample, Block& block)
+    {
+        block.x = sample.x();
+        block.y = sample.y();
+        block.orientation = sample.orientation();
+        block.battery_level = sample.battery_level();
+        block.speed = sample.speed();
+        block.status = static_cast<uint32_t>(sample.status());
+        block.timestamp = sample.timestamp();
+    }
+
+    template<typename Block>
+    void readBlock(const unsigned char* data, RobotTelemetry& sample)
+    {
+        Block block;
+        std::memcpy(&block, data, sizeof(block));
+        sample.x(block.x);
+        sample.y(block.y);
+        sample.orientation(block.orientation);
+        sample.battery_level(block.battery_level);
+        sample.speed(block.speed);
+        sample.status(static_cast<RobotStatus>(block.status));
+        sample.timestamp(block.timestamp);
+    }
+
+    // checks a received payload against the fixed layout; false = not for
+    // the fast path (other encoding, truncated or malformed)
+    bool parseLayout(const SerializedPayload_t& payload, Layout& layout, const char*& id)
+    {
+        if (!kLittleEndian || payload.length < kEncapsulationSize + 8 || payload.data[0] != 0)
+            return false;
+
+        uint8_t kind = payload.data[1];
+        if (kind != kPlainCdrLe && kind != kDelimitCdr2Le)
+            return false;
+
+        bool xcdr2 = kind == kDelimitCdr2Le;
+        uint32_t end = payload.length;
+        if (xcdr2)
+        {
+            // DHEADER: bytes of the members that follow it
+            uint32_t dheader;
+            std::memcpy(&dheader, payload.data + kEncapsulationSize, sizeof(dheader));
+            if (dheader > payload.length - kEncapsulationSize - 4)
+                return false;
+            end = kEncapsulationSize + 4 + dheader;
+        }
+
+        uint32_t id_size;
+        std::memcpy(&id_size, payload.data + kEncapsulationSize + (xcdr2 ? 4 : 0), sizeof(id_size));
+        if (id_size == 0 || id_size > RobotTelemetryFastPubSubType::kMaxFastIdLength + 1)
+            return false;
+
+        layout = makeLayout(xcdr2, id_size);
+        if (layout.size > end)
+            return false;
+
+        id = reinterpret_cast<const char*>(payload.data + layout.id_length_offset + 4);
+        return id[id_size - 1] == '\0';
+    }
+}
+
+RobotTelemetryFastPubSubType::RobotTelemetryFastPubSubType()
+    : RobotTelemetryPubSubType()
+{
+}
+
+uint32_t RobotTelemetryFastPubSubType::calculate_serialized_size(
+        const void* const data,
+        DataRepresentationId_t data_representation)
+{
+    const RobotTelemetry& sample = *static_cast<const RobotTelemetry*>(data);
+    if (!kLittleEndian || sample.id().size() > kMaxFastIdLength)
+        return RobotTelemetryPubSubType::calculate_serialized_size(data, data_representation);
+
+    bool xcdr2 = data_representation != DataRepresentationId_t::XCDR_DATA_REPRESENTATION;
+    return makeLayout(xcdr2, static_cast<uint32_t>(sample.id().size()) + 1).size;
+}
+
+bool RobotTelemetryFastPubSubType::serialize(
+        const void* const data,
+        SerializedPayload_t& payload,
+        DataRepresentationId_t data_representation)
+{
+    const RobotTelemetry& sample = *static_cast<const RobotTelemetry*>(data);
+    const std::string& id = sample.id();
+    if (!kLittleEndian || id.size() > kMaxFastIdLength)
+        return RobotTelemetryPubSubType::serialize(data, payload, data_representation);
+
+    // the generated code also treats everything but XCDR as XCDRv2
+    bool xcdr2 = data_representation != DataRepresentationId_t::XCDR_DATA_REPRESENTATION;
+    uint32_t id_size = static_cast<uint32_t>(id.size()) + 1;
+    Layout layout = makeLayout(xcdr2, id_size);
+    if (payload.max_size < layout.size)
+        return false;
+
+    unsigned char* out = payload.data;
+    out[0] = 0;
+    out[1] = xcdr2 ? kDelimitCdr2Le : kPlainCdrLe;
+    out[2] = 0;
+    out[3] = 0;
+
+    if (xcdr2)
+    {
+        uint32_t dheader = layout.size - kEncapsulationSize - 4;
+        std::memcpy(out + kEncapsulationSize, &dheader, sizeof(dheader));
+    }
+
+    std::memcpy(out + layout.id_length_offset, &id_size, sizeof(id_size));
+    unsigned char* id_end = out + layout.id_length_offset + 4;
+    std::memcpy(id_end, id.data(), id.size());
+    id_end += id.size();
+    // '\0' and the alignment padding up to the numeric block
+    std::memset(id_end, 0, static_cast<std::size_t>(out + layout.numeric_offset - id_end));
+
+    if (xcdr2)
+    {
+        NumericBlockV2 block;
+        fillBlock(sample, block);
+        std::memcpy(out + layout.numeric_offset, &block, sizeof(block));
+    }
+    else
+    {
+        NumericBlockV1 block = {};
+        fillBlock(sample, block);
+        std::memcpy(out + layout.numeric_offset, &block, sizeof(block));
+    }
+
+    payload.encapsulation = CDR_LE;
+    payload.length = layout.size;
+    return true;
+}
+
+bool RobotTelemetryFastPubSubType::deserialize(
+        SerializedPayload_t& payload,
+        void* data)
+{
+    Layout layout;
+    const char* id;
+    if (!parseLayout(payload, layout, id))
+        return RobotTelemetryPubSubType::deserialize(payload, data);
+
+    RobotTelemetry& sample = *static_cast<RobotTelemetry*>(data);
+    sample.id().assign(id, layout.id_size - 1);
+
+    if (layout.xcdr2)
+        readBlock<NumericBlockV2>(payload.data + layout.numeric_offset, sample);
+    else
+        readBlock<NumericBlockV1>(payload.data + layout.numeric_offset, sample);
+
+    payload.encapsulation = CDR_LE;
+    return true;
+}
+
+void RobotTelemetryFastPubSubType::hashKey(const char* id, uint32_t length, InstanceHandle_t& ihandle)
+{
+    // the key is serialized big-endian XCDRv2: uint32 length ('\0' included), chars, '\0';
+    // RobotTelemetry_max_key_cdr_typesize > 16, so the handle is always its MD5
+    unsigned char key[4 + kMaxFastIdLength + 1];
+    uint32_t size = length + 1;
+    key[0] = static_cast<unsigned char>(size >> 24);
+    key[1] = static_cast<unsigned char>(size >> 16);
+    key[2] = static_cast<unsigned char>(size >> 8);
+    key[3] = static_cast<unsigned char>(size);
+    std::memcpy(key + 4, id, length);
+    key[4 + length] = 0;
+
+    key_md5_.init();
+    key_md5_.update(key, 4 + size);
+    key_md5_.finalize();
+    for (uint8_t i = 0; i < 16; ++i)
+        ihandle.value[i] = key_md5_.digest[i];
+}
+
+bool RobotTelemetryFastPubSubType::compute_key(
+        const void* const data,
+        InstanceHandle_t& ihandle,
+        bool force_md5)
+{
+    const std::string& id = static_cast<const RobotTelemetry*>(data)->id();
+    if (id.size() > kMaxFastIdLength)
+        return RobotTelemetryPubSubType::compute_key(data, ihandle, force_md5);
+
+    hashKey(id.data(), static_cast<uint32_t>(id.size()), ihandle);
+    return true;
+}
+
+bool RobotTelemetryFastPubSubType::compute_key(
+        SerializedPayload_t& payload,
+        InstanceHandle_t& ihandle,
+        bool force_md5)
+{
+    // only the id is needed, no full deserialize
+    Layout layout;
+    const char* id;
+    if (!parseLayout(payload, layout, id))
+        return RobotTelemetryPubSubType::compute_key(payload, ihandle, force_md5);
+
+    hashKey(id, layout.id_size - 1, ihandle);
+    return true;
+}
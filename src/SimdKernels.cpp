@@ -0,0 +1,68 @@
+#include "SimdKernels.hpp"
+#include "RobotModels.hpp"
+
+namespace SimdKernels
+{
+
+Isa detectIsa()
+{
+#ifdef ROBOT_SIMD_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return Isa::AVX2;
+#endif
+    return Isa::SCALAR;
+}
+
+const char* isaName(Isa isa)
+{
+    switch (isa)
+    {
+        case Isa::AVX2:
+            return "AVX2";
+        case Isa::SCALAR:
+        default:
+            return "SCALAR";
+    }
+}
+
+void circularPhase(Isa isa, std::size_t count,
+                   const double* angular_velocity, double time,
+                   double* cos_out, double* sin_out, double* orientation_out)
+{
+#ifdef ROBOT_SIMD_AVX2
+    if (isa == Isa::AVX2)
+    {
+        detail::circularPhaseAvx2(count, angular_velocity, time, cos_out, sin_out, orientation_out);
+        return;
+    }
+#endif
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        RobotModels::circularPhase(angular_velocity[i] * time,
+                                   cos_out[i], sin_out[i], orientation_out[i]);
+    }
+}
+
+void batteryStep(Isa isa, std::size_t count, double dt, const uint8_t* moving,
+                 const float* drain_rate, const float* charge_rate,
+                 float* level, uint8_t* charging)
+{
+#ifdef ROBOT_SIMD_AVX2
+    if (isa == Isa::AVX2)
+    {
+        detail::batteryStepAvx2(count, dt, moving, drain_rate, charge_rate, level, charging);
+        return;
+    }
+#endif
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        bool is_charging = charging[i] != 0;
+        RobotModels::batteryStep(dt, moving[i] != 0, drain_rate[i], charge_rate[i], level[i], is_charging);
+        charging[i] = is_charging ? 1 : 0;
+    }
+}
+
+}
@@ -0,0 +1,265 @@
+// AVX2 + FMA versions of the SimdKernels
+// this file is compiled with -mavx2 -mfma -ffp-contract=off (see CMakeLists.txt)
+
+#include "SimdKernels.hpp"
+#include "RobotModels.hpp"
+#include <immintrin.h>
+#include <cmath>
+#include <cstring>
+
+namespace SimdKernels
+{
+namespace detail
+{
+
+namespace
+{
+    // pi/2 split in three parts (fdlibm) for the Cody-Waite argument reduction;
+    // q * PIO2_1 is exact for |q| < 2^20, hence kMaxVectorAngle
+    const double PIO2_1 = 1.57079632673412561417e+00;
+    const double PIO2_2 = 6.07710050630396597660e-11;
+    const double PIO2_3 = 2.02226624871116645580e-21;
+    const double TWO_OVER_PI = 6.36619772367581382433e-01;
+
+    // fdlibm __kernel_sin / __kernel_cos minimax coefficients on [-pi/4, pi/4]
+    const double S1 = -1.66666666666666324348e-01;
+    const double S2 = 8.33333333332248946124e-03;
+    const double S3 = -1.98412698298579493134e-04;
+    const double S4 = 2.75573137070700676789e-06;
+    const double S5 = -2.50507602534068634195e-08;
+    const double S6 = 1.58969099521155010221e-10;
+
+    const double C1 = 4.16666666666666019037e-02;
+    const double C2 = -1.38888888888741095749e-03;
+    const double C3 = 2.48015872894767294178e-05;
+    const double C4 = -2.75573143513906633035e-07;
+    const double C5 = 2.08757232129817482790e-09;
+    const double C6 = -1.13596475577881948265e-11;
+
+    inline void sincos4(__m256d x, __m256d& s_out, __m256d& c_out)
+    {
+        // q = nearest integer to x / (pi/2), r = x - q * pi/2
+        __m256d q = _mm256_round_pd(_mm256_mul_pd(x, _mm256_set1_pd(TWO_OVER_PI)),
+                                    _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        __m256d r = _mm256_fnmadd_pd(q, _mm256_set1_pd(PIO2_1), x);
+        r = _mm256_fnmadd_pd(q, _mm256_set1_pd(PIO2_2), r);
+        r = _mm256_fnmadd_pd(q, _mm256_set1_pd(PIO2_3), r);
+
+        __m256d z = _mm256_mul_pd(r, r);
+
+        // sin(r) = r + r^3 * P(z)
+        __m256d ps = _mm256_fmadd_pd(z, _mm256_set1_pd(S6), _mm256_set1_pd(S5));
+        ps = _mm256_fmadd_pd(z, ps, _mm256_set1_pd(S4));
+        ps = _mm256_fmadd_pd(z, ps, _mm256_set1_pd(S3));
+        ps = _mm256_fmadd_pd(z, ps, _mm256_set1_pd(S2));
+        ps = _mm256_fmadd_pd(z, ps, _mm256_set1_pd(S1));
+        __m256d sin_r = _mm256_fmadd_pd(_mm256_mul_pd(z, r), ps, r);
+
+        // cos(r) = 1 - z/2 + z^2 * Q(z)
+        __m256d pc = _mm256_fmadd_pd(z, _mm256_set1_pd(C6), _mm256_set1_pd(C5));
+        pc = _mm256_fmadd_pd(z, pc, _mm256_set1_pd(C4));
+        pc = _mm256_fmadd_pd(z, pc, _mm256_set1_pd(C3));
+        pc = _mm256_fmadd_pd(z, pc, _mm256_set1_pd(C2));
+        pc = _mm256_fmadd_pd(z, pc, _mm256_set1_pd(C1));
+        __m256d cos_r = _mm256_fmadd_pd(_mm256_mul_pd(z, z), pc,
+                                        _mm256_fnmadd_pd(z, _mm256_set1_pd(0.5), _mm256_set1_pd(1.0)));
+
+        // quadrant: bit 0 swaps sin/cos, bit 1 negates sin, (q + 1) bit 1 negates cos
+        __m256i qi = _mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(q));
+        __m256d swap = _mm256_castsi256_pd(
+            _mm256_cmpeq_epi64(_mm256_and_si256(qi, _mm256_set1_epi64x(1)), _mm256_set1_epi64x(1)));
+        __m256d sin_sign = _mm256_castsi256_pd(
+            _mm256_slli_epi64(_mm256_and_si256(qi, _mm256_set1_epi64x(2)), 62));
+        __m256d cos_sign = _mm256_castsi256_pd(
+            _mm256_slli_epi64(_mm256_and_si256(_mm256_add_epi64(qi, _mm256_set1_epi64x(1)),
+                                               _mm256_set1_epi64x(2)), 62));
+
+        s_out = _mm256_xor_pd(_mm256_blendv_pd(sin_r, cos_r, swap), sin_sign);
+        c_out = _mm256_xor_pd(_mm256_blendv_pd(cos_r, sin_r, swap), cos_sign);
+    }
+
+    // heading = angle + pi/2 wrapped into [0, 2pi) without loops
+    inline __m256d wrapOrientation4(__m256d angle)
+    {
+        const __m256d two_pi = _mm256_set1_pd(2 * M_PI);
+
+        __m256d o = _mm256_add_pd(angle, _mm256_set1_pd(M_PI / 2.0));
+        __m256d k = _mm256_floor_pd(_mm256_div_pd(o, two_pi));
+        o = _mm256_fnmadd_pd(k, two_pi, o);
+
+        // floor() of a rounded quotient can be off by one at the edges
+        __m256d negative = _mm256_cmp_pd(o, _mm256_setzero_pd(), _CMP_LT_OQ);
+        o = _mm256_add_pd(o, _mm256_and_pd(negative, two_pi));
+        __m256d over = _mm256_cmp_pd(o, two_pi, _CMP_GE_OQ);
+        o = _mm256_sub_pd(o, _mm256_and_pd(over, two_pi));
+
+        return o;
+    }
+
+    inline void circularPhase4(const double* angular_velocity, double time,
+                               double* cos_out, double* sin_out, double* orientation_out)
+    {
+        __m256d angle = _mm256_mul_pd(_mm256_loadu_pd(angular_velocity), _mm256_set1_pd(time));
+
+        __m256d s, c;
+        sincos4(angle, s, c);
+        _mm256_storeu_pd(cos_out, c);
+        _mm256_storeu_pd(sin_out, s);
+        _mm256_storeu_pd(orientation_out, wrapOrientation4(angle));
+
+        // lanes outside the reduction range use the scalar model
+        __m256d abs_angle = _mm256_andnot_pd(_mm256_set1_pd(-0.0), angle);
+        int out_of_range = _mm256_movemask_pd(
+            _mm256_cmp_pd(abs_angle, _mm256_set1_pd(kMaxVectorAngle), _CMP_NLE_UQ));
+        if (out_of_range != 0)
+        {
+            for (int k = 0; k < 4; k++)
+            {
+                if (out_of_range & (1 << k))
+                {
+                    RobotModels::circularPhase(angular_velocity[k] * time,
+                                               cos_out[k], sin_out[k], orientation_out[k]);
+                }
+            }
+        }
+    }
+
+    // 8 x 32 bit lane mask: bytes[k] == value
+    inline __m256i byteMask8(const uint8_t* bytes, uint8_t value)
+    {
+        int64_t packed;
+        std::memcpy(&packed, bytes, sizeof(packed));
+        __m256i wide = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(packed));
+        return _mm256_cmpeq_epi32(wide, _mm256_set1_epi32(value));
+    }
+
+    // float + rate * dt with the float -> double -> float rounding of RobotModels
+    inline __m256 addScaled8(__m256 level, __m256 rate, __m256d vdt, bool subtract)
+    {
+        __m256d lvl_lo = _mm256_cvtps_pd(_mm256_castps256_ps128(level));
+        __m256d lvl_hi = _mm256_cvtps_pd(_mm256_extractf128_ps(level, 1));
+        __m256d step_lo = _mm256_mul_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(rate)), vdt);
+        __m256d step_hi = _mm256_mul_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(rate, 1)), vdt);
+
+        __m128 lo = _mm256_cvtpd_ps(subtract ? _mm256_sub_pd(lvl_lo, step_lo) : _mm256_add_pd(lvl_lo, step_lo));
+        __m128 hi = _mm256_cvtpd_ps(subtract ? _mm256_sub_pd(lvl_hi, step_hi) : _mm256_add_pd(lvl_hi, step_hi));
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+    }
+
+    // 8 x 32 bit mask -> 8 bytes of 0/1
+    inline void storeFlags8(__m256 mask, uint8_t* flags)
+    {
+        __m256i bytes = _mm256_srli_epi32(_mm256_castps_si256(mask), 31);
+        __m128i words = _mm_packs_epi32(_mm256_castsi256_si128(bytes), _mm256_extracti128_si256(bytes, 1));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(flags), _mm_packus_epi16(words, words));
+    }
+
+    inline void batteryStep8(double dt, const uint8_t* moving_flags,
+                             const float* drain_rate, const float* charge_rate,
+                             float* level, uint8_t* charging)
+    {
+        const __m256d vdt = _mm256_set1_pd(dt);
+
+        __m256 moving = _mm256_castsi256_ps(_mm256_xor_si256(byteMask8(moving_flags, 0), _mm256_set1_epi32(-1)));
+        __m256 old_level = _mm256_loadu_ps(level);
+        __m256 down = addScaled8(old_level, _mm256_loadu_ps(drain_rate), vdt, true);
+        __m256 empty = _mm256_cmp_ps(down, _mm256_setzero_ps(), _CMP_LE_OQ);
+        down = _mm256_max_ps(down, _mm256_setzero_ps());
+
+        int64_t any_charging;
+        std::memcpy(&any_charging, charging, sizeof(any_charging));
+        if (any_charging == 0)
+        {
+            // the usual case: nobody charges, so the charge lanes aren't computed
+            // moving ? down : level, charging = moving && empty
+            _mm256_storeu_ps(level, _mm256_blendv_ps(old_level, down, moving));
+            __m256 now_charging = _mm256_and_ps(moving, empty);
+            if (_mm256_movemask_ps(now_charging) != 0)
+                storeFlags8(now_charging, charging);
+            return;
+        }
+
+        __m256 not_charging = _mm256_castsi256_ps(byteMask8(charging, 0));
+        __m256 up = addScaled8(old_level, _mm256_loadu_ps(charge_rate), vdt, false);
+        __m256 full = _mm256_cmp_ps(up, _mm256_set1_ps(100.0f), _CMP_GE_OQ);
+        up = _mm256_min_ps(up, _mm256_set1_ps(100.0f));
+
+        // charging ? up : (moving ? down : level)
+        __m256 new_level = _mm256_blendv_ps(up, _mm256_blendv_ps(old_level, down, moving), not_charging);
+        // charging ? !full : (moving && empty)
+        __m256 still_charging = _mm256_xor_ps(full, _mm256_castsi256_ps(_mm256_set1_epi32(-1)));
+        __m256 new_charging = _mm256_blendv_ps(still_charging, _mm256_and_ps(moving, empty), not_charging);
+
+        _mm256_storeu_ps(level, new_level);
+        storeFlags8(new_charging, charging);
+    }
+}
+
+void circularPhaseAvx2(std::size_t count,
+                       const double* angular_velocity, double time,
+                       double* cos_out, double* sin_out, double* orientation_out)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        circularPhase4(angular_velocity + i, time, cos_out + i, sin_out + i, orientation_out + i);
+    }
+
+    std::size_t tail = count - i;
+    if (tail > 0)
+    {
+        double w[4] = {0.0, 0.0, 0.0, 0.0};
+        double c[4], s[4], o[4];
+        for (std::size_t k = 0; k < tail; k++)
+            w[k] = angular_velocity[i + k];
+
+        circularPhase4(w, time, c, s, o);
+
+        for (std::size_t k = 0; k < tail; k++)
+        {
+            cos_out[i + k] = c[k];
+            sin_out[i + k] = s[k];
+            orientation_out[i + k] = o[k];
+        }
+    }
+}
+
+void batteryStepAvx2(std::size_t count, double dt, const uint8_t* moving,
+                     const float* drain_rate, const float* charge_rate,
+                     float* level, uint8_t* charging)
+{
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        batteryStep8(dt, moving + i, drain_rate + i, charge_rate + i, level + i, charging + i);
+    }
+
+    std::size_t tail = count - i;
+    if (tail > 0)
+    {
+        uint8_t mov[8] = {};
+        float dr[8] = {};
+        float cr[8] = {};
+        float lvl[8] = {};
+        uint8_t chg[8] = {};
+        for (std::size_t k = 0; k < tail; k++)
+        {
+            mov[k] = moving[i + k];
+            dr[k] = drain_rate[i + k];
+            cr[k] = charge_rate[i + k];
+            lvl[k] = level[i + k];
+            chg[k] = charging[i + k];
+        }
+
+        batteryStep8(dt, mov, dr, cr, lvl, chg);
+
+        for (std::size_t k = 0; k < tail; k++)
+        {
+            level[i + k] = lvl[k];
+            charging[i + k] = chg[k];
+        }
+    }
+}
+
+}
+}
@@ -0,0 +1,382 @@
+#include "TelemetryDeltaCodec.hpp"
+#include "TelemetryConversions.hpp"
+#include <algorithm>
+
+const std::size_t TelemetryDeltaEncoder::kMaxFrameSize;
+const uint32_t TelemetryDeltaEncoder::kDefaultKeyframeInterval;
+const uint32_t TelemetryDeltaEncoder::kMaxStreams;
+const std::size_t TelemetryDeltaEncoder::kMaxIdSize;
+
+namespace
+{
+    const int kFieldCount = TelemetryDeltaStream::FIELD_COUNT;
+
+    // frame header: [K|seq:15] big-endian, so a seq gap is missed only if a
+    // robot loses exactly a multiple of 32768 frames (55 min at 10 Hz)
+    const uint16_t kKeyframeFlag = 0x8000;
+    const uint16_t kSequenceMask = 0x7FFF;
+    const std::size_t kHeaderSize = 2;
+
+    void writeHeader(std::vector<uint8_t>& out, bool keyframe, uint16_t sequence)
+    {
+        uint16_t header = static_cast<uint16_t>((keyframe ? kKeyframeFlag : 0) | sequence);
+        out.push_back(static_cast<uint8_t>(header >> 8));
+        out.push_back(static_cast<uint8_t>(header));
+    }
+
+    // false on a truncated header
+    bool readHeader(const uint8_t*& in, const uint8_t* end, bool& keyframe, uint16_t& sequence)
+    {
+        if (static_cast<std::size_t>(end - in) < kHeaderSize)
+            return false;
+
+        uint16_t header = static_cast<uint16_t>((in[0] << 8) | in[1]);
+        in += kHeaderSize;
+        keyframe = (header & kKeyframeFlag) != 0;
+        sequence = header & kSequenceMask;
+        return true;
+    }
+
+    // fields predicted as last + (last - previous), the others as last
+    const bool kSecondOrder[kFieldCount] = {true, true, true, true, false, false, false};
+
+    uint64_t zigzag(int64_t value)
+    {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    int64_t unzigzag(uint64_t value)
+    {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    void writeVarint(std::vector<uint8_t>& out, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(value));
+    }
+
+    // false on a truncated or over-long varint
+    bool readVarint(const uint8_t*& in, const uint8_t* end, uint64_t& value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 64 && in != end; shift += 7)
+        {
+            uint8_t byte = *in++;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+                return true;
+        }
+        return false;
+    }
+
+    // signed fields are sign-extended, so their residuals stay small around 0
+    void toFields(const RobotTelemetryCompact& compact, uint64_t* fields)
+    {
+        fields[TelemetryDeltaStream::TIMESTAMP] = compact.timestamp();
+        fields[TelemetryDeltaStream::X] = static_cast<uint64_t>(static_cast<int64_t>(compact.x_mm()));
+        fields[TelemetryDeltaStream::Y] = static_cast<uint64_t>(static_cast<int64_t>(compact.y_mm()));
+        fields[TelemetryDeltaStream::ORIENTATION] = compact.orientation();
+        fields[TelemetryDeltaStream::SPEED] = static_cast<uint64_t>(static_cast<int64_t>(compact.speed_mm_s()));
+        fields[TelemetryDeltaStream::BATTERY] = compact.battery_percent();
+        fields[TelemetryDeltaStream::STATUS] = static_cast<uint32_t>(compact.status());
+    }
+
+    void fromFields(const uint64_t* fields, RobotTelemetryCompact& compact)
+    {
+        compact.timestamp(fields[TelemetryDeltaStream::TIMESTAMP]);
+        compact.x_mm(static_cast<int32_t>(fields[TelemetryDeltaStream::X]));
+        compact.y_mm(static_cast<int32_t>(fields[TelemetryDeltaStream::Y]));
+        compact.orientation(static_cast<uint16_t>(fields[TelemetryDeltaStream::ORIENTATION]));
+        compact.speed_mm_s(static_cast<int16_t>(fields[TelemetryDeltaStream::SPEED]));
+        compact.battery_percent(static_cast<uint8_t>(fields[TelemetryDeltaStream::BATTERY]));
+        compact.status(static_cast<RobotStatus>(static_cast<uint32_t>(fields[TelemetryDeltaStream::STATUS])));
+    }
+
+    // a keyframe predicts 0 for every field
+    uint64_t predict(const TelemetryDeltaStream& stream, int field)
+    {
+        if (kSecondOrder[field])
+            return stream.last[field] + (stream.last[field] - stream.previous[field]);
+        return stream.last[field];
+    }
+
+    void advance(TelemetryDeltaStream& stream, const uint64_t* fields, bool keyframe)
+    {
+        for (int f = 0; f < kFieldCount; f++)
+        {
+            // after a keyframe the predicted step is 0
+            stream.previous[f] = keyframe ? fields[f] : stream.last[f];
+            stream.last[f] = fields[f];
+        }
+    }
+
+    // the body after the header: every field of a keyframe, or the mask and
+    // residuals of a delta (0 for the fields left out). Needs no stream state,
+    // so a batch record can be skipped. False on a truncated or malformed body.
+    bool readBody(const uint8_t*& in, const uint8_t* end, bool keyframe, uint64_t* values)
+    {
+        // no mask, or a mask bit beyond the fields
+        if (!keyframe && (in == end || (*in & ~((1u << kFieldCount) - 1)) != 0))
+            return false;
+        uint8_t mask = keyframe ? static_cast<uint8_t>((1u << kFieldCount) - 1) : *in++;
+
+        for (int f = 0; f < kFieldCount; f++)
+        {
+            uint64_t value = 0;
+            if ((mask & (1u << f)) && !readVarint(in, end, value))
+                return false;
+            values[f] = static_cast<uint64_t>(unzigzag(value));
+        }
+        return true;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// TelemetryDeltaEncoder
+// ----------------------------------------------------------------------------
+
+TelemetryDeltaEncoder::TelemetryDeltaEncoder(uint32_t keyframe_interval)
+    : keyframe_interval_(std::max<uint32_t>(keyframe_interval, 1))
+{
+}
+
+bool TelemetryDeltaEncoder::encode(const RobotTelemetry& telemetry, std::vector<uint8_t>& frame)
+{
+    frame.clear();
+    return append(telemetry, false, frame);
+}
+
+bool TelemetryDeltaEncoder::encodeRecord(const RobotTelemetry& telemetry, std::vector<uint8_t>& records)
+{
+    return append(telemetry, true, records);
+}
+
+bool TelemetryDeltaEncoder::append(const RobotTelemetry& telemetry, bool record, std::vector<uint8_t>& out)
+{
+    TelemetryConversions::toCompact(telemetry, quantized_);
+    uint64_t fields[kFieldCount];
+    toFields(quantized_, fields);
+
+    // emplace() would build a node on every call, so only on a robot's first sample
+    auto it = streams_.find(telemetry.id());
+    bool first = it == streams_.end();
+    if (first)
+    {
+        TelemetryDeltaStream stream;
+        stream.slot = static_cast<uint32_t>(streams_.size());
+        it = streams_.emplace(telemetry.id(), stream).first;
+    }
+    TelemetryDeltaStream& stream = it->second;
+    bool keyframe = first || stream.since_keyframe >= keyframe_interval_;
+
+    stream.sequence = static_cast<uint16_t>((stream.sequence + 1) & kSequenceMask);
+    if (record)
+        writeVarint(out, stream.slot);
+    writeHeader(out, keyframe, stream.sequence);
+
+    if (keyframe)
+    {
+        if (record)
+        {
+            // binds the slot to the robot on the decoder side
+            std::size_t length = std::min(telemetry.id().size(), kMaxIdSize);
+            writeVarint(out, length);
+            out.insert(out.end(), telemetry.id().begin(), telemetry.id().begin() + length);
+        }
+
+        for (int f = 0; f < kFieldCount; f++)
+            writeVarint(out, zigzag(static_cast<int64_t>(fields[f])));
+        stream.since_keyframe = 1;
+    }
+    else
+    {
+        uint64_t residual[kFieldCount];
+        uint8_t mask = 0;
+        for (int f = 0; f < kFieldCount; f++)
+        {
+            residual[f] = zigzag(static_cast<int64_t>(fields[f] - predict(stream, f)));
+            if (residual[f] != 0)
+                mask |= static_cast<uint8_t>(1u << f);
+        }
+
+        out.push_back(mask);
+        for (int f = 0; f < kFieldCount; f++)
+        {
+            if (mask & (1u << f))
+                writeVarint(out, residual[f]);
+        }
+        stream.since_keyframe++;
+    }
+
+    advance(stream, fields, keyframe);
+    return keyframe;
+}
+
+void TelemetryDeltaEncoder::requestKeyframes()
+{
+    for (auto& entry : streams_)
+        entry.second.since_keyframe = keyframe_interval_;
+}
+
+// ----------------------------------------------------------------------------
+// TelemetryDeltaDecoder
+// ----------------------------------------------------------------------------
+
+TelemetryDeltaDecoder::TelemetryDeltaDecoder()
+    : keyframes_(0)
+    , deltas_(0)
+    , skipped_(0)
+    , gaps_(0)
+    , malformed_(0)
+{
+}
+
+bool TelemetryDeltaDecoder::decode(const std::string& id, const std::vector<uint8_t>& frame, RobotTelemetry& telemetry)
+{
+    const uint8_t* in = frame.data();
+    const uint8_t* end = in + frame.size();
+    bool keyframe;
+    uint16_t sequence;
+    if (frame.size() > TelemetryDeltaEncoder::kMaxFrameSize || !readHeader(in, end, keyframe, sequence))
+    {
+        malformed_++;
+        return false;
+    }
+
+    TelemetryDeltaStream* stream = nullptr;
+    if (keyframe)
+    {
+        stream = &streams_[id];
+    }
+    else
+    {
+        auto it = streams_.find(id);
+        if (it != streams_.end())
+            stream = &it->second;
+    }
+
+    uint64_t values[kFieldCount];
+    if (!readBody(in, end, keyframe, values) || in != end)
+    {
+        if (stream != nullptr)
+            stream->synced = false;
+        malformed_++;
+        return false;
+    }
+
+    uint64_t fields[kFieldCount];
+    if (!apply(stream, keyframe, sequence, values, fields))
+        return false;
+
+    rebuild(fields, id, telemetry);
+    return true;
+}
+
+bool TelemetryDeltaDecoder::decodeRecords(const std::string& writer, const std::vector<uint8_t>& records,
+                                          const std::function<void(const RobotTelemetry&)>& deliver)
+{
+    std::vector<RecordStream>& slots = writers_[writer];
+    const uint8_t* in = records.data();
+    const uint8_t* end = in + records.size();
+
+    while (in != end)
+    {
+        uint64_t slot;
+        bool keyframe;
+        uint16_t sequence;
+        if (!readVarint(in, end, slot) || slot >= TelemetryDeltaEncoder::kMaxStreams
+            || !readHeader(in, end, keyframe, sequence))
+        {
+            malformed_++;
+            return false;
+        }
+        if (keyframe)
+        {
+            uint64_t length;
+            if (!readVarint(in, end, length) || length > TelemetryDeltaEncoder::kMaxIdSize ||
+                length > static_cast<uint64_t>(end - in))
+            {
+                malformed_++;
+                return false;
+            }
+
+            if (slot >= slots.size())
+                slots.resize(slot + 1);
+            slots[slot].id.assign(reinterpret_cast<const char*>(in), length);
+            in += length;
+        }
+
+        // a slot never bound by a keyframe has nothing to predict from
+        TelemetryDeltaStream* stream = slot < slots.size() ? &slots[slot].stream : nullptr;
+
+        uint64_t values[kFieldCount];
+        if (!readBody(in, end, keyframe, values))
+        {
+            // the next record's start is lost with this one
+            if (stream != nullptr)
+                stream->synced = false;
+            malformed_++;
+            return false;
+        }
+
+        uint64_t fields[kFieldCount];
+        if (apply(stream, keyframe, sequence, values, fields))
+        {
+            rebuild(fields, slots[slot].id, record_sample_);
+            deliver(record_sample_);
+        }
+    }
+
+    return true;
+}
+
+bool TelemetryDeltaDecoder::apply(TelemetryDeltaStream* stream, bool keyframe, uint16_t sequence,
+                                  const uint64_t* values, uint64_t* fields)
+{
+    if (keyframe)
+    {
+        for (int f = 0; f < kFieldCount; f++)
+            fields[f] = values[f];
+    }
+    else
+    {
+        if (stream == nullptr || !stream->synced)
+        {
+            skipped_++;
+            return false;
+        }
+
+        if (sequence != ((stream->sequence + 1) & kSequenceMask))
+        {
+            // the prediction needs every frame, wait for the next keyframe
+            gaps_++;
+            skipped_++;
+            stream->synced = false;
+            return false;
+        }
+
+        for (int f = 0; f < kFieldCount; f++)
+            fields[f] = predict(*stream, f) + values[f];
+    }
+
+    advance(*stream, fields, keyframe);
+    stream->sequence = sequence;
+    stream->synced = true;
+    if (keyframe)
+        keyframes_++;
+    else
+        deltas_++;
+    return true;
+}
+
+void TelemetryDeltaDecoder::rebuild(const uint64_t* fields, const std::string& id, RobotTelemetry& telemetry)
+{
+    fromFields(fields, quantized_);
+    quantized_.id(id);
+    TelemetryConversions::fromCompact(quantized_, telemetry);
+}
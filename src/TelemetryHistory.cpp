@@ -0,0 +1,229 @@
+#include "TelemetryHistory.hpp"
+#include <algorithm>
+
+const std::size_t TelemetryHistory::kMetrics;
+const std::size_t TelemetryHistory::kTiers;
+const std::size_t TelemetryHistory::kLockStripes;
+
+namespace
+{
+    const uint64_t kSecondNs = 1000000000ull;
+
+    // left uninitialized: the OS only backs the pages of robots that report
+    template<typename T>
+    std::unique_ptr<T[]> column(std::size_t size)
+    {
+        return std::unique_ptr<T[]>(new T[size]);
+    }
+}
+
+TelemetryHistory::Config TelemetryHistory::defaultConfig(std::size_t max_robots)
+{
+    Config config;
+    config.max_robots = max_robots;
+    config.raw_capacity = 600;
+    config.tier_capacity[static_cast<std::size_t>(Tier::SECOND)] = 300;
+    config.tier_capacity[static_cast<std::size_t>(Tier::TEN_SECONDS)] = 360;
+    config.tier_capacity[static_cast<std::size_t>(Tier::MINUTE)] = 60;
+    return config;
+}
+
+uint64_t TelemetryHistory::tierWidth(Tier tier)
+{
+    switch (tier)
+    {
+        case Tier::SECOND:      return kSecondNs;
+        case Tier::TEN_SECONDS: return 10 * kSecondNs;
+        case Tier::MINUTE:      return 60 * kSecondNs;
+        default:                return kSecondNs;
+    }
+}
+
+const char* TelemetryHistory::tierName(Tier tier)
+{
+    switch (tier)
+    {
+        case Tier::SECOND:      return "1s";
+        case Tier::TEN_SECONDS: return "10s";
+        case Tier::MINUTE:      return "1min";
+        default:                return "?";
+    }
+}
+
+std::size_t TelemetryHistory::bytesPerRobot(const Config& config)
+{
+    std::size_t bytes = sizeof(Ring) + config.raw_capacity * (sizeof(uint64_t) + kMetrics * sizeof(float));
+    for (std::size_t t = 0; t < kTiers; t++)
+    {
+        bytes += sizeof(Ring)
+            + config.tier_capacity[t] * (sizeof(uint64_t) + sizeof(uint32_t) + 3 * kMetrics * sizeof(float));
+    }
+    return bytes;
+}
+
+std::size_t TelemetryHistory::memoryBytes() const
+{
+    return config_.max_robots * bytesPerRobot(config_) + index_.memoryBytes();
+}
+
+TelemetryHistory::TelemetryHistory(const Config& config)
+    : config_(config)
+    , index_(config.max_robots)
+    , rejected_(0)
+{
+    config_.raw_capacity = std::max<std::size_t>(1, config_.raw_capacity);
+
+    std::size_t robots = config_.max_robots;
+    raw_rings_.reset(new Ring[robots]());
+    raw_time_ = column<uint64_t>(robots * config_.raw_capacity);
+    for (std::size_t m = 0; m < kMetrics; m++)
+        raw_values_[m] = column<float>(robots * config_.raw_capacity);
+
+    for (std::size_t t = 0; t < kTiers; t++)
+    {
+        config_.tier_capacity[t] = std::max<std::size_t>(1, config_.tier_capacity[t]);
+
+        TierData& tier = tiers_[t];
+        tier.capacity = config_.tier_capacity[t];
+        tier.width = tierWidth(static_cast<Tier>(t));
+        std::size_t size = robots * tier.capacity;
+
+        tier.rings.reset(new Ring[robots]());
+        tier.start = column<uint64_t>(size);
+        tier.samples = column<uint32_t>(size);
+        for (std::size_t m = 0; m < kMetrics; m++)
+        {
+            tier.min[m] = column<float>(size);
+            tier.max[m] = column<float>(size);
+            tier.mean[m] = column<float>(size);
+        }
+    }
+}
+
+bool TelemetryHistory::append(const RobotTelemetry& telemetry)
+{
+    std::size_t robot = index_.insert(telemetry.id());
+    if (robot == index_.capacity())
+    {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    float values[kMetrics];
+    values[static_cast<std::size_t>(Metric::X)] = static_cast<float>(telemetry.x());
+    values[static_cast<std::size_t>(Metric::Y)] = static_cast<float>(telemetry.y());
+    values[static_cast<std::size_t>(Metric::BATTERY)] = telemetry.battery_level();
+    values[static_cast<std::size_t>(Metric::SPEED)] = static_cast<float>(telemetry.speed());
+    uint64_t timestamp = telemetry.timestamp();
+
+    std::lock_guard<std::mutex> lock(robotMutex(robot));
+
+    Ring& raw = raw_rings_[robot];
+    std::size_t capacity = config_.raw_capacity;
+    std::size_t base = robot * capacity;
+
+    // the rings are kept in time order so range queries can binary search
+    if (raw.count > 0 && timestamp < raw_time_[base + (raw.head + capacity - 1) % capacity])
+    {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    std::size_t position = base + raw.head;
+    raw_time_[position] = timestamp;
+    for (std::size_t m = 0; m < kMetrics; m++)
+        raw_values_[m][position] = values[m];
+
+    raw.head = static_cast<uint32_t>((raw.head + 1) % capacity);
+    raw.count = static_cast<uint32_t>(std::min<std::size_t>(raw.count + 1, capacity));
+
+    for (TierData& tier : tiers_)
+        addToTier(tier, robot, timestamp, values);
+
+    return true;
+}
+
+void TelemetryHistory::addToTier(TierData& tier, std::size_t robot, uint64_t timestamp, const float* values)
+{
+    uint64_t bucket = timestamp - timestamp % tier.width;
+    Ring& ring = tier.rings[robot];
+    std::size_t base = robot * tier.capacity;
+
+    if (ring.count > 0)
+    {
+        std::size_t last = base + (ring.head + tier.capacity - 1) % tier.capacity;
+        if (tier.start[last] == bucket)
+        {
+            // same bucket: fold the sample in
+            uint32_t samples = ++tier.samples[last];
+            for (std::size_t m = 0; m < kMetrics; m++)
+            {
+                tier.min[m][last] = std::min(tier.min[m][last], values[m]);
+                tier.max[m][last] = std::max(tier.max[m][last], values[m]);
+                tier.mean[m][last] += (values[m] - tier.mean[m][last]) / samples;
+            }
+            return;
+        }
+    }
+
+    // new bucket (buckets without samples are skipped, not stored)
+    std::size_t position = base + ring.head;
+    tier.start[position] = bucket;
+    tier.samples[position] = 1;
+    for (std::size_t m = 0; m < kMetrics; m++)
+    {
+        tier.min[m][position] = values[m];
+        tier.max[m][position] = values[m];
+        tier.mean[m][position] = values[m];
+    }
+
+    ring.head = static_cast<uint32_t>((ring.head + 1) % tier.capacity);
+    ring.count = static_cast<uint32_t>(std::min<std::size_t>(ring.count + 1, tier.capacity));
+}
+
+TelemetryHistory::Range TelemetryHistory::locate(const Ring& ring, std::size_t capacity, const uint64_t* times,
+                                                 uint64_t from, uint64_t to)
+{
+    Range range = {{0, 0}, {0, 0}};
+    if (ring.count == 0 || from > to)
+        return range;
+
+    std::size_t oldest = (ring.head + capacity - ring.count) % capacity;
+    auto timeAt = [&](std::size_t i) { return times[(oldest + i) % capacity]; };
+
+    // first entry >= from
+    std::size_t low = 0;
+    std::size_t high = ring.count;
+    while (low < high)
+    {
+        std::size_t middle = (low + high) / 2;
+        if (timeAt(middle) < from)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    std::size_t first = low;
+
+    // first entry > to
+    high = ring.count;
+    while (low < high)
+    {
+        std::size_t middle = (low + high) / 2;
+        if (timeAt(middle) <= to)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    std::size_t end = low;
+
+    if (first >= end)
+        return range;
+
+    std::size_t begin = (oldest + first) % capacity;
+    std::size_t count = end - first;
+    range.begin[0] = begin;
+    range.count[0] = std::min(count, capacity - begin);
+    range.begin[1] = 0;
+    range.count[1] = count - range.count[0];
+    return range;
+}
@@ -0,0 +1,363 @@
+#include "TelemetryRecorder.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace TelemetryRecording;
+
+namespace
+{
+    std::size_t roundUp(std::size_t value, std::size_t multiple)
+    {
+        return (value + multiple - 1) / multiple * multiple;
+    }
+
+    int64_t nowNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+}
+
+TelemetryRecorder::Config TelemetryRecorder::defaultConfig(const std::string& directory)
+{
+    Config config;
+    config.directory = directory;
+    config.segment_records = 1 << 20;
+    config.index_stride = 1024;
+    config.idle_sleep_ms = 5;
+    return config;
+}
+
+TelemetryRecorder::TelemetryRecorder()
+    : page_size_(static_cast<std::size_t>(sysconf(_SC_PAGESIZE)))
+    , count_(0)
+    , last_ns_(0)
+    , syncing_(nullptr)
+    , next_number_(1)
+    , failed_(false)
+    , stopping_(false)
+    , running_(false)
+    , recorded_(0)
+    , dropped_(0)
+    , stalls_(0)
+    , segments_(0)
+{
+}
+
+TelemetryRecorder::~TelemetryRecorder()
+{
+    stop();
+}
+
+bool TelemetryRecorder::start(const Config& config)
+{
+    if (running_.load(std::memory_order_acquire))
+        return true;
+
+    config_ = config;
+    config_.segment_records = std::max<uint64_t>(1, config_.segment_records);
+    config_.index_stride = std::max<uint64_t>(1, config_.index_stride);
+
+    // never overwrite an earlier recording in the same directory; segments
+    // preallocated but never written by a crashed recorder hold no data
+    std::size_t stale = removePendingSegments(config_.directory);
+    if (stale > 0)
+        std::cout << "[Recorder] Removed " << stale << " unused preallocated segment(s)" << std::endl;
+    next_number_ = lastSegmentNumber(config_.directory) + 1;
+
+    current_ = createSegment(next_number_++);
+    if (!current_ || !activateSegment(*current_))
+    {
+        if (current_)
+            discardSegment(std::move(current_));
+        return false;
+    }
+
+    count_ = 0;
+    last_ns_ = 0;
+    syncing_ = current_.get();
+    failed_ = false;
+    stopping_ = false;
+    segments_.store(1, std::memory_order_relaxed);
+
+    running_.store(true, std::memory_order_release);
+    sync_thread_ = std::thread(&TelemetryRecorder::syncLoop, this);
+
+    std::cout << "[Recorder] Recording to " << config_.directory
+              << " (" << config_.segment_records << " records per segment)" << std::endl;
+    return true;
+}
+
+void TelemetryRecorder::stop()
+{
+    if (!running_.load(std::memory_order_acquire))
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (current_)
+            retired_.push_back(std::move(current_));
+        syncing_ = nullptr;
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    sync_thread_.join();
+    running_.store(false, std::memory_order_release);
+
+    std::cout << "[Recorder] Stopped: " << getRecorded() << " samples in " << getSegments() << " segment(s)";
+    if (getDropped() > 0)
+        std::cout << ", " << getDropped() << " dropped";
+    std::cout << std::endl;
+}
+
+bool TelemetryRecorder::record(const RobotTelemetry& telemetry)
+{
+    if (!current_ || (count_ == current_->header->capacity && !rotate()))
+    {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // the index needs non-decreasing times, even if the system clock steps back
+    int64_t now = std::max(nowNs(), last_ns_);
+    last_ns_ = now;
+
+    Record record;
+    fillRecord(record, telemetry, now);
+    record.sequence = static_cast<uint32_t>(count_ + 1);
+    record.checksum = checksum(record);
+
+    Segment& segment = *current_;
+    std::memcpy(&segment.records[count_], &record, sizeof(Record));
+
+    if (count_ % config_.index_stride == 0)
+    {
+        IndexEntry& entry = segment.index[count_ / config_.index_stride];
+        entry.record = count_;
+        entry.recorded_ns = now;
+    }
+
+    count_++;
+    segment.committed.store(count_, std::memory_order_release);
+    recorded_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool TelemetryRecorder::rotate()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    retired_.push_back(std::move(current_));
+    syncing_ = nullptr;
+
+    if (!next_ && !failed_)
+    {
+        // the sync thread is still creating it (disk slower than the stream)
+        stalls_.fetch_add(1, std::memory_order_relaxed);
+        cv_.notify_all();
+        cv_.wait(lock, [this]() { return next_ || failed_; });
+    }
+
+    if (!next_)
+    {
+        cv_.notify_all();
+        return false;
+    }
+
+    current_ = std::move(next_);
+    syncing_ = current_.get();
+    count_ = 0;
+    segments_.fetch_add(1, std::memory_order_relaxed);
+    // once per segment; the records go to the mapping whatever its name is
+    activateSegment(*current_);
+
+    // start on the one after
+    cv_.notify_all();
+    return true;
+}
+
+std::unique_ptr<TelemetryRecorder::Segment> TelemetryRecorder::createSegment(uint64_t number)
+{
+    // preallocated under a name the readers skip, until a record goes in
+    std::unique_ptr<Segment> segment(new Segment());
+    segment->number = number;
+    segment->path = pendingSegmentPath(config_.directory, number);
+    segment->pending = true;
+
+    uint64_t capacity = config_.segment_records;
+    uint64_t index_entries = capacity / config_.index_stride + 1;
+    std::size_t index_offset = kHeaderSize;
+    std::size_t records_offset = roundUp(index_offset + index_entries * sizeof(IndexEntry), page_size_);
+    segment->bytes = records_offset + capacity * sizeof(Record);
+
+    segment->fd = ::open(segment->path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (segment->fd < 0)
+    {
+        std::cerr << "[Recorder] Error: cannot create " << segment->path << ": " << std::strerror(errno) << std::endl;
+        return nullptr;
+    }
+
+    // reserve the blocks now, so the mapping never hits ENOSPC (SIGBUS) later
+    int err = posix_fallocate(segment->fd, 0, static_cast<off_t>(segment->bytes));
+    if (err != 0)
+    {
+        std::cerr << "[Recorder] Error: cannot allocate " << segment->path << ": " << std::strerror(err) << std::endl;
+        ::close(segment->fd);
+        unlink(segment->path.c_str());
+        return nullptr;
+    }
+
+    int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+    // prefault the page tables here, not on the ingest thread
+    flags |= MAP_POPULATE;
+#endif
+    void* mapping = mmap(nullptr, segment->bytes, PROT_READ | PROT_WRITE, flags, segment->fd, 0);
+    if (mapping == MAP_FAILED)
+    {
+        std::cerr << "[Recorder] Error: cannot map " << segment->path << ": " << std::strerror(errno) << std::endl;
+        ::close(segment->fd);
+        unlink(segment->path.c_str());
+        return nullptr;
+    }
+
+    segment->base = static_cast<char*>(mapping);
+    segment->header = reinterpret_cast<SegmentHeader*>(segment->base);
+    segment->index = reinterpret_cast<IndexEntry*>(segment->base + index_offset);
+    segment->records = reinterpret_cast<Record*>(segment->base + records_offset);
+    segment->committed.store(0, std::memory_order_relaxed);
+    segment->synced = records_offset;
+
+    SegmentHeader& header = *segment->header;
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.record_size = sizeof(Record);
+    header.segment = number;
+    header.capacity = capacity;
+    header.index_stride = config_.index_stride;
+    header.index_offset = index_offset;
+    header.records_offset = records_offset;
+    header.created_ns = nowNs();
+    header.record_count = 0;
+    header.first_ns = 0;
+    header.last_ns = 0;
+    header.closed = 0;
+    msync(segment->base, kHeaderSize, MS_SYNC);
+
+    return segment;
+}
+
+bool TelemetryRecorder::activateSegment(Segment& segment)
+{
+    std::string path = segmentPath(config_.directory, segment.number);
+    if (::rename(segment.path.c_str(), path.c_str()) != 0)
+    {
+        // still recorded, the rename is retried when the segment is closed
+        std::cerr << "[Recorder] Error: cannot rename " << segment.path << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    segment.path = path;
+    segment.pending = false;
+    return true;
+}
+
+bool TelemetryRecorder::syncCommitted(Segment& segment)
+{
+    uint64_t committed = segment.committed.load(std::memory_order_acquire);
+    std::size_t end = segment.header->records_offset + committed * sizeof(Record);
+    std::size_t page_end = end / page_size_ * page_size_;
+    if (page_end <= segment.synced)
+        return false;
+
+    msync(segment.base + segment.synced, page_end - segment.synced, MS_SYNC);
+    segment.synced = page_end;
+
+    // index entries (only an accelerator, the reader checks them)
+    std::size_t index_end = segment.header->index_offset
+        + (committed / config_.index_stride + 1) * sizeof(IndexEntry);
+    msync(segment.base, roundUp(index_end, page_size_), MS_ASYNC);
+    return true;
+}
+
+void TelemetryRecorder::closeSegment(std::unique_ptr<Segment> segment)
+{
+    uint64_t committed = segment->committed.load(std::memory_order_acquire);
+    msync(segment->base, segment->bytes, MS_SYNC);
+
+    SegmentHeader& header = *segment->header;
+    header.record_count = committed;
+    header.first_ns = committed > 0 ? segment->records[0].recorded_ns : 0;
+    header.last_ns = committed > 0 ? segment->records[committed - 1].recorded_ns : 0;
+    header.closed = 1;
+    msync(segment->base, kHeaderSize, MS_SYNC);
+
+    // give back the unused preallocation
+    std::size_t used = header.records_offset + committed * sizeof(Record);
+    munmap(segment->base, segment->bytes);
+    if (ftruncate(segment->fd, static_cast<off_t>(used)) != 0)
+        std::cerr << "[Recorder] Warning: cannot truncate " << segment->path << std::endl;
+    fsync(segment->fd);
+    ::close(segment->fd);
+
+    if (segment->pending)
+        activateSegment(*segment);
+}
+
+void TelemetryRecorder::discardSegment(std::unique_ptr<Segment> segment)
+{
+    munmap(segment->base, segment->bytes);
+    ::close(segment->fd);
+    unlink(segment->path.c_str());
+}
+
+void TelemetryRecorder::syncLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        if (!next_ && !failed_ && !stopping_)
+        {
+            uint64_t number = next_number_++;
+            lock.unlock();
+            std::unique_ptr<Segment> segment = createSegment(number);
+            lock.lock();
+
+            if (segment)
+                next_ = std::move(segment);
+            else
+                failed_ = true;
+            cv_.notify_all();
+        }
+
+        std::vector<std::unique_ptr<Segment>> retired;
+        retired.swap(retired_);
+        Segment* current = syncing_;
+        bool stopping = stopping_;
+
+        // current_ is only retired (and then closed) under the mutex, so it
+        // stays alive while it is synced here
+        lock.unlock();
+        for (std::unique_ptr<Segment>& segment : retired)
+            closeSegment(std::move(segment));
+        bool synced = current != nullptr && syncCommitted(*current);
+        lock.lock();
+
+        if (stopping && retired_.empty())
+            break;
+
+        if (!synced && retired_.empty())
+            cv_.wait_for(lock, std::chrono::milliseconds(config_.idle_sleep_ms));
+    }
+
+    if (next_)
+        discardSegment(std::move(next_));
+}
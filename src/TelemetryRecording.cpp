@@ -0,0 +1,266 @@
+#include "TelemetryRecording.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace TelemetryRecording
+{
+    namespace
+    {
+        const char kPrefix[] = "segment-";
+        const char kSuffix[] = ".rtrec";
+        // preallocated segment the recorder has not written to yet
+        const char kPendingSuffix[] = ".rtrec.tmp";
+
+        // segment number from a file name ending in `ending`, 0 if it is not one
+        uint64_t segmentNumber(const std::string& name, const char* ending)
+        {
+            const std::size_t prefix = sizeof(kPrefix) - 1;
+            const std::size_t suffix = std::strlen(ending);
+            if (name.size() <= prefix + suffix
+                || name.compare(0, prefix, kPrefix) != 0
+                || name.compare(name.size() - suffix, suffix, ending) != 0)
+            {
+                return 0;
+            }
+
+            std::string digits = name.substr(prefix, name.size() - prefix - suffix);
+            if (digits.find_first_not_of("0123456789") != std::string::npos)
+                return 0;
+            return std::strtoull(digits.c_str(), nullptr, 10);
+        }
+
+        std::vector<std::pair<uint64_t, std::string>> scanDirectory(const std::string& directory,
+                                                                    const char* ending = kSuffix)
+        {
+            std::vector<std::pair<uint64_t, std::string>> segments;
+            DIR* dir = opendir(directory.c_str());
+            if (dir == nullptr)
+                return segments;
+
+            while (dirent* entry = readdir(dir))
+            {
+                uint64_t number = segmentNumber(entry->d_name, ending);
+                if (number > 0)
+                    segments.emplace_back(number, directory + "/" + entry->d_name);
+            }
+            closedir(dir);
+
+            std::sort(segments.begin(), segments.end());
+            return segments;
+        }
+    }
+
+    uint32_t checksum(const Record& record)
+    {
+        // FNV-1a over the 64-bit words after the checksum, seeded with the sequence
+        const std::size_t words = (sizeof(Record) - 8) / sizeof(uint64_t);
+        uint64_t data[words];
+        std::memcpy(data, reinterpret_cast<const char*>(&record) + 8, sizeof(data));
+
+        uint64_t hash = 14695981039346656037ull ^ record.sequence;
+        for (std::size_t i = 0; i < words; i++)
+        {
+            hash ^= data[i];
+            hash *= 1099511628211ull;
+        }
+        return static_cast<uint32_t>(hash ^ (hash >> 32));
+    }
+
+    void fillRecord(Record& record, const RobotTelemetry& telemetry, int64_t recorded_ns)
+    {
+        std::memset(record.id, 0, sizeof(record.id));
+        std::memcpy(record.id, telemetry.id().data(), std::min(telemetry.id().size(), kIdSize - 1));
+        record.recorded_ns = recorded_ns;
+        record.x = telemetry.x();
+        record.y = telemetry.y();
+        record.orientation = telemetry.orientation();
+        record.speed = telemetry.speed();
+        record.timestamp = telemetry.timestamp();
+        record.battery_level = telemetry.battery_level();
+        record.status = telemetry.status();
+    }
+
+    void toTelemetry(const Record& record, RobotTelemetry& telemetry)
+    {
+        telemetry.id().assign(record.id);
+        telemetry.x(record.x);
+        telemetry.y(record.y);
+        telemetry.orientation(record.orientation);
+        telemetry.speed(record.speed);
+        telemetry.timestamp(record.timestamp);
+        telemetry.battery_level(record.battery_level);
+        telemetry.status(record.status);
+    }
+
+    std::string segmentPath(const std::string& directory, uint64_t segment)
+    {
+        char name[64];
+        std::snprintf(name, sizeof(name), "%s%06llu%s", kPrefix, static_cast<unsigned long long>(segment), kSuffix);
+        return directory + "/" + name;
+    }
+
+    std::string pendingSegmentPath(const std::string& directory, uint64_t segment)
+    {
+        char name[64];
+        std::snprintf(name, sizeof(name), "%s%06llu%s", kPrefix, static_cast<unsigned long long>(segment), kPendingSuffix);
+        return directory + "/" + name;
+    }
+
+    std::vector<std::string> listSegments(const std::string& directory)
+    {
+        std::vector<std::string> paths;
+        for (const auto& segment : scanDirectory(directory))
+            paths.push_back(segment.second);
+        return paths;
+    }
+
+    uint64_t lastSegmentNumber(const std::string& directory)
+    {
+        std::vector<std::pair<uint64_t, std::string>> segments = scanDirectory(directory);
+        return segments.empty() ? 0 : segments.back().first;
+    }
+
+    std::size_t removePendingSegments(const std::string& directory)
+    {
+        std::size_t removed = 0;
+        for (const auto& segment : scanDirectory(directory, kPendingSuffix))
+        {
+            if (unlink(segment.second.c_str()) == 0)
+                removed++;
+        }
+        return removed;
+    }
+
+    SegmentReader::SegmentReader()
+        : fd_(-1)
+        , base_(nullptr)
+        , bytes_(0)
+        , header_(nullptr)
+        , index_(nullptr)
+        , records_(nullptr)
+        , count_(0)
+    {
+    }
+
+    SegmentReader::~SegmentReader()
+    {
+        close();
+    }
+
+    bool SegmentReader::open(const std::string& path)
+    {
+        close();
+
+        fd_ = ::open(path.c_str(), O_RDONLY);
+        if (fd_ < 0)
+            return false;
+
+        struct stat info;
+        if (fstat(fd_, &info) != 0 || static_cast<std::size_t>(info.st_size) < kHeaderSize)
+        {
+            close();
+            return false;
+        }
+
+        bytes_ = static_cast<std::size_t>(info.st_size);
+        void* mapping = mmap(nullptr, bytes_, PROT_READ, MAP_SHARED, fd_, 0);
+        if (mapping == MAP_FAILED)
+        {
+            close();
+            return false;
+        }
+        base_ = static_cast<char*>(mapping);
+        header_ = reinterpret_cast<const SegmentHeader*>(base_);
+
+        if (std::memcmp(header_->magic, kMagic, sizeof(kMagic)) != 0
+            || header_->version != kVersion
+            || header_->record_size != sizeof(Record)
+            || header_->index_stride == 0
+            || header_->records_offset > bytes_)
+        {
+            close();
+            return false;
+        }
+
+        index_ = reinterpret_cast<const IndexEntry*>(base_ + header_->index_offset);
+        records_ = reinterpret_cast<const Record*>(base_ + header_->records_offset);
+        count_ = recover();
+
+        // sequential reads: let the kernel read ahead
+        madvise(base_, bytes_, MADV_SEQUENTIAL);
+        return true;
+    }
+
+    void SegmentReader::close()
+    {
+        if (base_ != nullptr)
+            munmap(base_, bytes_);
+        if (fd_ >= 0)
+            ::close(fd_);
+
+        fd_ = -1;
+        base_ = nullptr;
+        bytes_ = 0;
+        header_ = nullptr;
+        index_ = nullptr;
+        records_ = nullptr;
+        count_ = 0;
+    }
+
+    bool SegmentReader::valid(uint64_t i) const
+    {
+        const Record& record = records_[i];
+        return record.sequence == i + 1 && record.checksum == checksum(record);
+    }
+
+    uint64_t SegmentReader::recover() const
+    {
+        // a closed segment may have been truncated to its records
+        uint64_t in_file = (bytes_ - header_->records_offset) / sizeof(Record);
+        uint64_t capacity = std::min<uint64_t>(header_->capacity, in_file);
+
+        if (header_->closed != 0)
+            return std::min<uint64_t>(header_->record_count, capacity);
+
+        // crash or still recording: keep the records up to the first bad one
+        uint64_t count = 0;
+        while (count < capacity && valid(count))
+            count++;
+        return count;
+    }
+
+    uint64_t SegmentReader::seek(int64_t time) const
+    {
+        // index entries written before a crash may have been lost; use the
+        // leading run that matches the records
+        uint64_t stride = header_->index_stride;
+        uint64_t entries = (count_ + stride - 1) / stride;
+        uint64_t low = 0;
+        uint64_t high = entries;
+        while (low < high)
+        {
+            uint64_t middle = (low + high) / 2;
+            const IndexEntry& entry = index_[middle];
+            bool usable = entry.record == middle * stride
+                && entry.recorded_ns == records_[entry.record].recorded_ns;
+            if (usable && entry.recorded_ns < time)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+
+        // records are in time order: scan from the last entry before `time`
+        uint64_t i = low > 0 ? (low - 1) * stride : 0;
+        while (i < count_ && records_[i].recorded_ns < time)
+            i++;
+        return i;
+    }
+}
@@ -0,0 +1,163 @@
+#include "TickScheduler.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+#ifdef __linux__
+#include <time.h>
+#endif
+
+const std::size_t TickScheduler::kJitterBuckets;
+
+TickScheduler::TickScheduler(double rate_hz, Policy policy, int64_t spin_ns)
+    : period_ns_(0)
+    , policy_(policy)
+    , spin_ns_(std::max<int64_t>(0, spin_ns))
+    , deadline_ns_(0)
+    , jitter_histogram_(kJitterBuckets, 0)
+{
+    setRate(rate_hz);
+    resetStats();
+}
+
+int64_t TickScheduler::nowNs()
+{
+#ifdef __linux__
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<int64_t>(now.tv_sec) * 1000000000 + now.tv_nsec;
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+void TickScheduler::setRate(double rate_hz)
+{
+    period_ns_ = std::max<int64_t>(1, static_cast<int64_t>(1e9 / std::max(rate_hz, 1e-3)));
+}
+
+void TickScheduler::start()
+{
+    deadline_ns_ = nowNs() + period_ns_;
+}
+
+uint64_t TickScheduler::wait()
+{
+    if (deadline_ns_ == 0)
+        start();
+
+    uint64_t advanced = 1;
+    int64_t now = nowNs();
+
+    if (now >= deadline_ns_)
+    {
+        // the work since the last tick ran past this deadline
+        overruns_++;
+
+        if (policy_ == Policy::SKIP && now - deadline_ns_ >= period_ns_)
+        {
+            // run now as the latest missed tick, drop the ones before it
+            uint64_t missed = static_cast<uint64_t>((now - deadline_ns_) / period_ns_);
+            deadline_ns_ += static_cast<int64_t>(missed) * period_ns_;
+            skipped_ += missed;
+            advanced += missed;
+        }
+    }
+    else
+    {
+        sleepUntil(deadline_ns_);
+        now = nowNs();
+    }
+
+    recordJitter(now - deadline_ns_);
+    ticks_++;
+
+    // next deadline stays on the grid, whatever the work or the wake-up cost
+    deadline_ns_ += period_ns_;
+    return advanced;
+}
+
+void TickScheduler::sleepUntil(int64_t deadline_ns) const
+{
+    int64_t sleep_until = deadline_ns - spin_ns_;
+
+    if (sleep_until > nowNs())
+    {
+#ifdef __linux__
+        timespec target;
+        target.tv_sec = static_cast<time_t>(sleep_until / 1000000000);
+        target.tv_nsec = static_cast<long>(sleep_until % 1000000000);
+        // absolute deadline: a signal or an early return just sleeps again
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &target, nullptr) == EINTR)
+        {
+        }
+#else
+        std::this_thread::sleep_for(std::chrono::nanoseconds(sleep_until - nowNs()));
+#endif
+    }
+
+    // busy-wait tail
+    while (nowNs() < deadline_ns)
+    {
+    }
+}
+
+void TickScheduler::recordJitter(int64_t late_ns)
+{
+    double late_us = std::max<int64_t>(0, late_ns) / 1000.0;
+    total_jitter_us_ += late_us;
+    max_jitter_us_ = std::max(max_jitter_us_, late_us);
+
+    std::size_t bucket = std::min<std::size_t>(static_cast<std::size_t>(late_us), kJitterBuckets - 1);
+    jitter_histogram_[bucket]++;
+}
+
+TickScheduler::Stats TickScheduler::getStats() const
+{
+    Stats stats;
+    stats.ticks = ticks_;
+    stats.overruns = overruns_;
+    stats.skipped = skipped_;
+    stats.mean_jitter_us = ticks_ > 0 ? total_jitter_us_ / ticks_ : 0.0;
+    stats.max_jitter_us = max_jitter_us_;
+    stats.p99_jitter_us = 0.0;
+
+    // upper edge of the bucket holding the 99th percentile
+    uint64_t target = ticks_ - ticks_ / 100;
+    uint64_t seen = 0;
+    for (std::size_t i = 0; i < kJitterBuckets && ticks_ > 0; i++)
+    {
+        seen += jitter_histogram_[i];
+        if (seen >= target)
+        {
+            stats.p99_jitter_us = i + 1 < kJitterBuckets ? static_cast<double>(i + 1) : max_jitter_us_;
+            break;
+        }
+    }
+
+    return stats;
+}
+
+void TickScheduler::printStats(const char* name) const
+{
+    Stats stats = getStats();
+    std::cout << "[" << name << "] " << stats.ticks << " ticks at " << std::fixed << std::setprecision(1)
+              << getRate() << " Hz | jitter mean: " << std::setprecision(1) << stats.mean_jitter_us
+              << " us, p99: < " << stats.p99_jitter_us
+              << " us, max: " << stats.max_jitter_us << " us"
+              << " | overruns: " << stats.overruns << " | skipped: " << stats.skipped << std::endl;
+}
+
+void TickScheduler::resetStats()
+{
+    ticks_ = 0;
+    overruns_ = 0;
+    skipped_ = 0;
+    total_jitter_us_ = 0.0;
+    max_jitter_us_ = 0.0;
+    std::fill(jitter_histogram_.begin(), jitter_histogram_.end(), 0);
+}
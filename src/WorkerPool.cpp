@@ -0,0 +1,152 @@
+#include "WorkerPool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <time.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace
+{
+    double elapsedUs(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    int64_t threadCpuNs()
+    {
+        timespec ts;
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+        return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+    }
+
+    void pinToCore(std::size_t worker)
+    {
+#ifdef __linux__
+        unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(worker % cores, &set);
+
+        if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+        {
+            std::cerr << "[WorkerPool] Warning: failed to pin worker " << worker << std::endl;
+        }
+#else
+        static_cast<void>(worker);
+#endif
+    }
+}
+
+WorkerPool::WorkerPool(std::size_t threads, bool pin_threads)
+    : exit_(false)
+    , generation_(0)
+    , pending_(0)
+    , count_(0)
+    , alignment_(1)
+    , job_(nullptr)
+{
+    threads = std::max<std::size_t>(1, threads);
+    worker_us_.assign(threads, 0.0);
+    worker_cpu_ns_.assign(threads, 0);
+
+    workers_.reserve(threads);
+    for (std::size_t i = 0; i < threads; i++)
+    {
+        workers_.emplace_back(&WorkerPool::workerLoop, this, i, pin_threads);
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        exit_ = true;
+        generation_++;
+    }
+    start_cv_.notify_all();
+
+    for (auto& worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+void WorkerPool::run(std::size_t count, const RangeJob& job, std::size_t alignment)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    count_ = count;
+    alignment_ = std::max<std::size_t>(1, alignment);
+    job_ = &job;
+    pending_ = workers_.size();
+    generation_++;
+    start_cv_.notify_all();
+
+    done_cv_.wait(lock, [this] { return pending_ == 0; });
+    job_ = nullptr;
+}
+
+int64_t WorkerPool::getCpuNs() const
+{
+    int64_t total = 0;
+    for (int64_t ns : worker_cpu_ns_)
+        total += ns;
+    return total;
+}
+
+void WorkerPool::workerLoop(std::size_t worker, bool pin)
+{
+    if (pin)
+        pinToCore(worker);
+
+    uint64_t seen = 0;
+
+    while (true)
+    {
+        std::size_t count;
+        std::size_t alignment;
+        const RangeJob* job;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            start_cv_.wait(lock, [this, seen] { return generation_ != seen; });
+            seen = generation_;
+            if (exit_)
+                return;
+            count = count_;
+            alignment = alignment_;
+            job = job_;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        std::size_t begin, end;
+        range(count, alignment, worker, begin, end);
+        if (begin < end)
+            (*job)(worker, begin, end);
+
+        // each worker only touches its own slots; run() returns after the job is done
+        worker_us_[worker] = elapsedUs(start);
+        worker_cpu_ns_[worker] = threadCpuNs();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--pending_ == 0)
+                done_cv_.notify_one();
+        }
+    }
+}
+
+// contiguous range of worker `worker` out of `count` items
+void WorkerPool::range(std::size_t count, std::size_t alignment, std::size_t worker,
+                       std::size_t& begin, std::size_t& end) const
+{
+    std::size_t workers = workers_.size();
+    std::size_t chunk = (count + workers - 1) / workers;
+    chunk = (chunk + alignment - 1) / alignment * alignment;
+
+    begin = std::min(count, worker * chunk);
+    end = std::min(count, begin + chunk);
+}
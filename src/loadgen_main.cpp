@@ -0,0 +1,341 @@
+#include "RobotPublisher.hpp"
+#include "RobotSimulator.hpp"
+#include "BenchFleet.hpp"
+#include "QoSProfiles.hpp"
+#include "TickScheduler.hpp"
+#include "WorkerPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <signal.h>
+#include <time.h>
+
+// Emulates a fleet where every robot owns its DDS participant, in one process.
+//
+// usage: load_generator [--robots N] [--threads N] [--rate HZ] [--seconds N]
+//                       [--idle-seconds N] [--peers a.b.c.d,...] [--best-effort]
+//
+//   --robots N        RobotPublisher + RobotSimulator pairs, one participant each (default 100)
+//   --threads N       shared worker threads that create, step and stop them
+//                     (default: hardware threads)
+//   --rate HZ         samples per robot per second (default 10)
+//   --seconds N       length of the publishing phase (default 30)
+//   --idle-seconds N  matched but silent phase before it: discovery traffic only (default 5)
+//   --peers ...       static discovery (QoSProfiles::getStaticPeersParticipantQoS),
+//                     the subscriber needs the same --peers
+//   --best-effort     BEST_EFFORT writers (default RELIABLE + TRANSIENT_LOCAL)
+//
+// Each phase (startup, idle, publishing) reports its duration, the bytes sent
+// on all interfaces (/proc/net/dev, so traffic of other processes counts
+// too), process CPU, resident memory and threads, in total and per robot, to
+// size the monitoring subscriber's host. The run ends with one CSV line to
+// compare runs with different --robots.
+
+volatile sig_atomic_t g_running = 1;
+
+void signalHandler(int signum)
+{
+    std::cout << "[Load generator] Signal received (" << signum << "), stopping..." << std::endl;
+    g_running = 0;
+}
+
+namespace
+{
+    struct Options
+    {
+        std::size_t robots = 100;
+        std::size_t threads = std::max(1u, std::thread::hardware_concurrency());
+        double rate_hz = 10.0;
+        double seconds = 30.0;
+        double idle_seconds = 5.0;
+        std::vector<std::string> peers;     // empty = multicast discovery
+        bool best_effort = false;
+    };
+
+    struct Robot
+    {
+        std::unique_ptr<RobotPublisher> publisher;
+        std::unique_ptr<RobotSimulator> simulator;
+        bool started = false;   // publisher->init() succeeded
+    };
+
+    // process-wide counters at one point in time
+    struct Snapshot
+    {
+        std::chrono::steady_clock::time_point time;
+        int64_t tx_bytes;
+        int64_t cpu_ns;
+        double rss_kb;
+        int threads;
+    };
+
+    bool parseOptions(int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string arg = argv[i];
+            if (arg == "--robots" && i + 1 < argc)
+                options.robots = std::max<std::size_t>(1, std::strtoull(argv[++i], nullptr, 10));
+            else if (arg == "--threads" && i + 1 < argc)
+                options.threads = std::max<std::size_t>(1, std::strtoull(argv[++i], nullptr, 10));
+            else if (arg == "--rate" && i + 1 < argc)
+                options.rate_hz = std::max(0.1, std::atof(argv[++i]));
+            else if (arg == "--seconds" && i + 1 < argc)
+                options.seconds = std::max(0.0, std::atof(argv[++i]));
+            else if (arg == "--idle-seconds" && i + 1 < argc)
+                options.idle_seconds = std::max(0.0, std::atof(argv[++i]));
+            else if (arg == "--peers" && i + 1 < argc)
+                options.peers = QoSProfiles::splitPeers(argv[++i]);
+            else if (arg == "--best-effort")
+                options.best_effort = true;
+            else
+                return false;
+        }
+        return true;
+    }
+
+    // TX bytes summed over every interface of /proc/net/dev
+    int64_t txBytes()
+    {
+        std::ifstream in("/proc/net/dev");
+        std::string line;
+        int64_t total = 0;
+        while (std::getline(in, line))
+        {
+            std::size_t colon = line.find(':');
+            if (colon == std::string::npos)
+                continue;
+
+            // receive: bytes packets errs drop fifo frame compressed multicast, then transmit bytes
+            std::istringstream fields(line.substr(colon + 1));
+            int64_t value = 0;
+            for (int i = 0; i < 9 && fields >> value; i++)
+            {
+            }
+            if (fields)
+                total += value;
+        }
+        return total;
+    }
+
+    Snapshot snapshot()
+    {
+        Snapshot s;
+        s.time = std::chrono::steady_clock::now();
+        s.tx_bytes = txBytes();
+
+        timespec ts;
+        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+        s.cpu_ns = static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+
+        // "VmRSS:   1234 kB", "Threads:  17"
+        s.rss_kb = 0.0;
+        s.threads = 0;
+        std::ifstream status("/proc/self/status");
+        std::string key;
+        while (status >> key)
+        {
+            if (key == "VmRSS:")
+                status >> s.rss_kb;
+            else if (key == "Threads:")
+                status >> s.threads;
+            status.ignore(4096, '\n');
+        }
+        return s;
+    }
+
+    double secondsBetween(const Snapshot& before, const Snapshot& after)
+    {
+        return std::chrono::duration<double>(after.time - before.time).count();
+    }
+
+    void printPhase(const char* name, const Snapshot& before, const Snapshot& after, std::size_t robots)
+    {
+        double seconds = std::max(secondsBetween(before, after), 1e-9);
+        double tx = static_cast<double>(after.tx_bytes - before.tx_bytes);
+        double cpu_percent = 100.0 * (after.cpu_ns - before.cpu_ns) / 1e9 / seconds;
+
+        std::cout << std::fixed << std::setprecision(1);
+        std::cout << "\n--- " << name << " (" << seconds << " s) ---" << std::endl;
+        std::cout << "TX:      " << tx / 1024.0 << " KB, " << tx / 1024.0 / seconds << " KB/s"
+                  << " (" << tx / seconds / robots << " B/s per robot)" << std::endl;
+        std::cout << "CPU:     " << cpu_percent << " % (" << std::setprecision(3) << cpu_percent / robots
+                  << " % per robot, 100 % = one core)" << std::endl;
+        std::cout << std::setprecision(1)
+                  << "RSS:     " << after.rss_kb / 1024.0 << " MB (" << std::showpos
+                  << (after.rss_kb - before.rss_kb) / 1024.0 << std::noshowpos << " MB)"
+                  << " | Threads: " << after.threads << std::endl;
+    }
+
+    // one sample per robot of [begin, end)
+    void stepRange(std::vector<Robot>& robots, std::size_t begin, std::size_t end, double dt,
+                   std::atomic<uint64_t>& published, std::atomic<uint64_t>& failed)
+    {
+        uint64_t ok = 0;
+        for (std::size_t i = begin; i < end; i++)
+        {
+            RobotSimulator& simulator = *robots[i].simulator;
+            simulator.update(dt);
+            if (robots[i].publisher->publishLoaned([&simulator](RobotTelemetry& sample) { simulator.fillTelemetry(sample); }))
+                ok++;
+        }
+        published.fetch_add(ok, std::memory_order_relaxed);
+        failed.fetch_add((end - begin) - ok, std::memory_order_relaxed);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        std::cerr << "usage: " << argv[0] << " [--robots N] [--threads N] [--rate HZ] [--seconds N]"
+                  << " [--idle-seconds N] [--peers a.b.c.d,...] [--best-effort]" << std::endl;
+        return 1;
+    }
+
+    signal(SIGINT, signalHandler);
+    signal(SIGTERM, signalHandler);
+
+    const std::size_t count = options.robots;
+    DataWriterQos qos = options.best_effort ? QoSProfiles::getBestEffortWriterQoS()
+                                            : QoSProfiles::getReliableTransientWriterQoS();
+    DomainParticipantQos pqos = options.peers.empty()
+        ? PARTICIPANT_QOS_DEFAULT
+        : QoSProfiles::getStaticPeersParticipantQoS(options.peers);
+
+    std::cout << "=== Robot load generator ===" << std::endl;
+    std::cout << "Robots: " << count << " (one participant each) | Threads: " << options.threads
+              << " | Rate: " << options.rate_hz << " Hz | Discovery: "
+              << (options.peers.empty() ? "multicast" : "static peers")
+              << " | QoS: " << (options.best_effort ? "BEST_EFFORT" : "RELIABLE + TRANSIENT_LOCAL") << std::endl;
+
+    WorkerPool pool(options.threads);
+    std::vector<Robot> robots(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        robots[i].publisher.reset(new RobotPublisher());
+        robots[i].publisher->setVerbose(false);
+        robots[i].simulator.reset(new RobotSimulator(BenchFleet::robotId(i)));
+        BenchFleet::configureRobot(*robots[i].simulator, i);
+    }
+
+    // startup: the participants are created on the pool, as robots booting together
+    Snapshot start = snapshot();
+    std::atomic<uint64_t> init_failed(0);
+    pool.run(count, [&](std::size_t, std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i = begin; i < end; i++)
+        {
+            robots[i].started = robots[i].publisher->init(qos, pqos);
+            if (!robots[i].started)
+                init_failed.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    Snapshot started = snapshot();
+    if (init_failed.load() > 0)
+        std::cerr << "[Load generator] " << init_failed.load() << " of " << count << " publishers failed to start" << std::endl;
+    printPhase("Startup", start, started, count);
+
+    // robots whose publisher failed to start are left out from here on
+    robots.erase(std::remove_if(robots.begin(), robots.end(),
+                                [](const Robot& robot) { return !robot.started; }),
+                 robots.end());
+    const std::size_t active = robots.size();
+    if (active == 0)
+    {
+        std::cerr << "[Load generator] No publisher started" << std::endl;
+        return 1;
+    }
+
+    // idle: only discovery (participant announcements, endpoint matching) on the wire
+    auto idle_end = started.time + std::chrono::duration<double>(options.idle_seconds);
+    while (g_running && std::chrono::steady_clock::now() < idle_end)
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    Snapshot idle = snapshot();
+    std::size_t matched = 0;
+    for (const Robot& robot : robots)
+    {
+        if (robot.publisher->getMatchedSubscribers() > 0)
+            matched++;
+    }
+    printPhase("Idle, discovery only", started, idle, active);
+    std::cout << "Publishers matched with a subscriber: " << matched << "/" << active << std::endl;
+
+    // publishing: every tick the pool steps and publishes its range of robots
+    std::atomic<uint64_t> published(0);
+    std::atomic<uint64_t> failed(0);
+    const double dt = 1.0 / options.rate_hz;
+    int64_t pool_cpu_start = pool.getCpuNs();
+    double max_step_ms = 0.0;
+    double total_step_ms = 0.0;
+    uint64_t steps = 0;
+    uint64_t ticks = 1;
+
+    auto load_end = idle.time + std::chrono::duration<double>(options.seconds);
+    TickScheduler scheduler(options.rate_hz, TickScheduler::Policy::SKIP);
+    scheduler.start();
+    while (g_running && std::chrono::steady_clock::now() < load_end)
+    {
+        auto step_start = std::chrono::steady_clock::now();
+        // skipped ticks still advance the simulation
+        double step_dt = dt * ticks;
+        pool.run(active, [&](std::size_t, std::size_t begin, std::size_t end)
+        {
+            stepRange(robots, begin, end, step_dt, published, failed);
+        });
+
+        double step_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - step_start).count();
+        max_step_ms = std::max(max_step_ms, step_ms);
+        total_step_ms += step_ms;
+        steps++;
+
+        ticks = scheduler.wait();
+    }
+
+    Snapshot loaded = snapshot();
+    double pool_cpu_us = (pool.getCpuNs() - pool_cpu_start) / 1000.0;
+    double load_seconds = std::max(secondsBetween(idle, loaded), 1e-9);
+    printPhase("Publishing", idle, loaded, active);
+    std::cout << std::setprecision(1)
+              << "Samples: " << published.load() << " (" << published.load() / load_seconds << "/s), failed: "
+              << failed.load() << std::endl;
+    std::cout << "Tick (step + publish all robots): avg " << std::setprecision(2)
+              << (steps ? total_step_ms / steps : 0.0) << " ms, max " << max_step_ms << " ms of "
+              << 1000.0 / options.rate_hz << " ms" << std::endl;
+    std::cout << "Pool CPU: " << (published.load() ? pool_cpu_us / published.load() : 0.0)
+              << " us per sample (step + fill + serialize + write)" << std::endl;
+    scheduler.printStats("Load generator");
+
+    pool.run(active, [&](std::size_t, std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i = begin; i < end; i++)
+            robots[i].publisher->stop();
+    });
+
+    // robots,threads,startup_s,startup_kb,rss_mb_per_robot,idle_bps_per_robot,load_bps_per_robot,
+    // load_cpu_percent_per_robot,samples_per_s
+    double startup_s = secondsBetween(start, started);
+    double idle_s = std::max(secondsBetween(started, idle), 1e-9);
+    std::cout << "\nCSV: robots,threads,startup_s,startup_tx_kb,rss_kb_per_robot,idle_tx_bps_per_robot,"
+              << "load_tx_bps_per_robot,load_cpu_percent_per_robot,samples_per_s" << std::endl;
+    std::cout << std::setprecision(3) << "CSV: " << active << ',' << options.threads << ','
+              << startup_s << ',' << (started.tx_bytes - start.tx_bytes) / 1024.0 << ','
+              << (idle.rss_kb - start.rss_kb) / active << ','
+              << (idle.tx_bytes - started.tx_bytes) / idle_s / active << ','
+              << (loaded.tx_bytes - idle.tx_bytes) / load_seconds / active << ','
+              << 100.0 * (loaded.cpu_ns - idle.cpu_ns) / 1e9 / load_seconds / active << ','
+              << published.load() / load_seconds << std::endl;
+
+    return init_failed.load() == 0 ? 0 : 1;
+}
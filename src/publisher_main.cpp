@@ -1,10 +1,16 @@
 #include "RobotPublisher.hpp"
 #include "RobotSimulator.hpp"
 #include "QoSProfiles.hpp"
+#include "AsyncLogger.hpp"
+#include "TelemetryLog.hpp"
+#include "TickScheduler.hpp"
+#include <algorithm>
 #include <iostream>
 #include <thread>
 #include <chrono>
 #include <cmath>
+#include <cstdlib>
+#include <string>
 #include <signal.h>
 
 //graceful shutdown
@@ -26,25 +32,44 @@ RobotSimulator createDefaultSimulator(const std::string& robot_id)
     return simulator;
 }
 
-void printTelemetryInfo(
-    const RobotTelemetry& telemetry,
-    int message_count,
-    int subscribers)
+// `--spin-us N`: busy-wait the last N us before each tick (default 0)
+int64_t spinFromArgs(int argc, char** argv)
 {
-    std::cout << "[Main] Msg #" << std::setw(4) << message_count
-              << " | Pos: (" << std::fixed << std::setprecision(2)
-              << std::setw(6) << telemetry.x()
-              << ", " << std::setw(6) << telemetry.y() << ")"
-              << " | θ: " << std::setw(5) << telemetry.orientation()
-              << " | Battery: " << std::setw(5) << telemetry.battery_level() << "%"
-              << " | Speed: " << std::setw(4) << telemetry.speed() << " m/s"
-              << " | Status: " << std::setw(12) << std::left << telemetry.status() << std::right
-              << " | Subs: " << subscribers
-              << std::endl;
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (std::string(argv[i]) == "--spin-us")
+            return std::atoll(argv[i + 1]) * 1000;
+    }
+    return 0;
+}
+
+// value following `name` on the command line, or nullptr
+const char* argValue(int argc, char** argv, const std::string& name)
+{
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (name == argv[i])
+            return argv[i + 1];
+    }
+    return nullptr;
 }
 
+// `--fast-cdr`: fixed-layout RobotTelemetry serializer (wire compatible)
+// `--compact`: quantized RobotTelemetryCompact on robot_telemetry_compact
+// `--delta`: keyframe + delta encoded RobotTelemetryDelta on robot_telemetry_delta
+// `--batch`: RobotTelemetryBatch on robot_telemetry_batch, flushed every tick
+// `--delta --batch`: delta frames batched in RobotTelemetryDeltaBatch on robot_telemetry_delta_batch
+bool hasFlag(int argc, char** argv, const std::string& name)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        if (name == argv[i])
+            return true;
+    }
+    return false;
+}
 
-int main()
+int main(int argc, char** argv)
 {
     std::cout<< "=== Robot Telemetry Publisher ==="<<std::endl;
     std::cout<< " Ctrl _ C to stop\n"<<std::endl;
@@ -53,6 +78,11 @@ int main()
     signal(SIGINT, signalHandler);
     signal(SIGTERM, signalHandler);
 
+    // console output is formatted and flushed on the logger thread
+    AsyncLogger& logger = AsyncLogger::instance();
+    logger.setSampling(AsyncLogger::Category::TELEMETRY, AsyncLogger::samplingFromArgs(argc, argv, 10));
+    logger.start();
+
     RobotPublisher publisher;
 
     std::cout << "[Publisher main] Select a QoS profile:" << std::endl;
@@ -60,13 +90,15 @@ int main()
     std::cout << "  2. BEST_EFFORT (Fast, no guarantees)" << std::endl;
     std::cout << "  3. RELIABLE + DEADLINE (Timeout detection)" << std::endl;
     std::cout << "  4. DEFAULT (No custom QoS)" << std::endl;
-    std::cout << "Option [1-4]: ";
+    std::cout << "  5. DATA-SHARING (RobotTelemetryPlain, same-host zero-copy)" << std::endl;
+    std::cout << "Option [1-5]: ";
 
     int choice;
     std::cin >> choice;
     std::cin.ignore();
 
     DataWriterQos qos;
+    bool plain = false;
     switch(choice)
     {
         case 1:
@@ -81,6 +113,11 @@ int main()
             qos = QoSProfiles::getReliableWithDeadlineWriterQoS();
             std::cout << "\n[Publisher main] Using: RELIABLE + DEADLINE(500ms)" << std::endl;
             break;
+        case 5:
+            qos = QoSProfiles::getDataSharingWriterQoS();
+            plain = true;
+            std::cout << "\n[Publisher main] Using: DATA-SHARING + RELIABLE + KEEP_LAST(16) on robot_telemetry_plain" << std::endl;
+            break;
         case 4:
         default:
             qos = DATAWRITER_QOS_DEFAULT;
@@ -89,38 +126,92 @@ int main()
     }
 
 
-    if(!publisher.init(qos))
+    bool compact = !plain && hasFlag(argc, argv, "--compact");
+    bool delta = !plain && !compact && hasFlag(argc, argv, "--delta");
+    bool batch = !plain && !compact && hasFlag(argc, argv, "--batch");
+    if (compact)
+        std::cout << "[Publisher main] Publishing RobotTelemetryCompact on robot_telemetry_compact" << std::endl;
+    if (delta && batch)
+        std::cout << "[Publisher main] Publishing RobotTelemetryDeltaBatch on robot_telemetry_delta_batch" << std::endl;
+    else if (delta)
+        std::cout << "[Publisher main] Publishing RobotTelemetryDelta on robot_telemetry_delta" << std::endl;
+    else if (batch)
+        std::cout << "[Publisher main] Publishing RobotTelemetryBatch on robot_telemetry_batch" << std::endl;
+
+    // `--peers a.b.c.d,...`: static discovery to these hosts, no multicast
+    // (the subscriber needs --peers too)
+    DomainParticipantQos pqos = PARTICIPANT_QOS_DEFAULT;
+    if (const char* peers = argValue(argc, argv, "--peers"))
+    {
+        pqos = QoSProfiles::getStaticPeersParticipantQoS(QoSProfiles::splitPeers(peers));
+        std::cout << "[Publisher main] Static discovery, initial peers: " << peers << std::endl;
+    }
+
+    publisher.setFastSerialization(hasFlag(argc, argv, "--fast-cdr"));
+    bool initialized = plain ? publisher.initPlain(qos, pqos)
+        : compact ? publisher.initCompact(qos, pqos)
+        : delta && batch ? publisher.initDeltaBatch(qos, TelemetryDeltaEncoder::kDefaultKeyframeInterval,
+                                                    RobotPublisher::kMaxBatchSamples, RobotPublisher::kDefaultBatchBytes, pqos)
+        : delta ? publisher.initDelta(qos, TelemetryDeltaEncoder::kDefaultKeyframeInterval, pqos)
+        : batch ? publisher.initBatch(qos, RobotPublisher::kMaxBatchSamples, RobotPublisher::kDefaultBatchBytes, pqos)
+        : publisher.init(qos, pqos);
+    if(!initialized)
     {
         std::cerr << "[Publisher main] Init error" << std::endl;
         return -1;
     }
 
     //DONE: implement a robot simulator to generate data
-    auto simulator = createDefaultSimulator("robo003");
+    const std::string robot_id = "robo003";
+    auto simulator = createDefaultSimulator(robot_id);
+    RobotTelemetry shown;
 
+    // `--wait-ms N`: wait up to N ms for the first subscriber (default 2000), then publish anyway
+    const char* wait_arg = argValue(argc, argv, "--wait-ms");
+    int wait_ms = wait_arg != nullptr ? std::max(0, std::atoi(wait_arg)) : 2000;
     std::cout << "[Publihser main] Waitin subscribers ... " << std::endl;
 
-    //wait subscribers
-    std::this_thread::sleep_for(std::chrono::seconds(2));
+    //wait subscribers: returns as soon as one matches
+    auto wait_start = std::chrono::steady_clock::now();
+    if (publisher.waitForMatch(wait_ms))
+        std::cout << "[Publisher main] Subscriber matched after "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(
+                         std::chrono::steady_clock::now() - wait_start).count() << " ms" << std::endl;
+    else
+        std::cout << "[Publisher main] No subscriber after " << wait_ms << " ms, publishing anyway" << std::endl;
 
     const double dt = 0.1;
     int message_count = 0;
 
+    // 10 Hz on absolute deadlines: publish time does not add up to the period
+    TickScheduler scheduler(1.0 / dt, TickScheduler::Policy::SKIP, spinFromArgs(argc, argv));
+    uint64_t ticks = 1;
+
     std::cout<< "[Publisher main] Start publishing" << std::endl;
+    scheduler.start();
 
     while(g_running)
     {
-        simulator.update(dt);
-        RobotTelemetry telemetry = simulator.generateTelemetry();
-
-        //public data
-        if(publisher.publish(telemetry))
+        // skipped ticks still advance the simulation
+        simulator.update(dt * ticks);
+
+        //public data - the simulator writes straight into the writer's sample
+        bool published = plain
+            ? publisher.publishPlain([&simulator](RobotTelemetryPlain& sample) { simulator.fillTelemetry(sample); })
+            : publisher.publishLoaned([&simulator](RobotTelemetry& sample) { simulator.fillTelemetry(sample); });
+        // batch mode: the tick's records go out now
+        published = publisher.flush() && published;
+        if(published)
         {
             message_count++;
 
-            //info every 10 messages
-            if (message_count % 10 == 0)
-                printTelemetryInfo(telemetry, message_count, publisher.getMatchedSubscribers());
+            //info for 1 in N messages
+            if (logger.sample(AsyncLogger::Category::TELEMETRY, robot_id))
+            {
+                simulator.fillTelemetry(shown);
+                logger.log(AsyncLogger::Category::TELEMETRY, &TelemetryLog::formatPublished,
+                           TelemetryLog::makeRecord(shown, message_count, publisher.getMatchedSubscribers()));
+            }
             
             if(simulator.getSimulationTime() > 20)
             {
@@ -132,20 +223,23 @@ int main()
         }
         else 
         {
-            std::cerr << "[Main publisher] Error to public!" << std::endl;
+            logger.text(AsyncLogger::Category::PUBLISHER, "[Main publisher] Error to public!");
         }
 
         // wait for the next tick
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        ticks = scheduler.wait();
     }
 
+    // the writer's listener logs until it is deleted: stop DDS first and the logger last
+    publisher.stop();
+    logger.stop();
+    scheduler.printStats("Publisher main");
+
     double total_sim_time = simulator.getSimulationTime();
 
     std::cout << "\n[Main] Total messages published: " << message_count << std::endl;
     std::cout << "[Main] Total simulated time: " << std::fixed << std::setprecision(1)
           << total_sim_time << " seconds" << std::endl;
 
-
-    publisher.stop();
     std::cout <<"[Main publisher] Publisher stopped!" << std::endl;
 }
\ No newline at end of file
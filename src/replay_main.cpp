@@ -0,0 +1,240 @@
+#include "RobotPublisher.hpp"
+#include "QoSProfiles.hpp"
+#include "TelemetryConversions.hpp"
+#include "TelemetryRecording.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include <signal.h>
+
+// Republishes a recording made with `subscriber --record DIR`.
+//
+// usage: replay DIR [--speed N | --max] [--now] [--loop N] [--reliable] [--plain]
+//
+//   --speed N   N x the recorded rate (default 1 = original timing)
+//   --max       as fast as the writer accepts
+//   --now       rewrite timestamps to the replay time
+//   --loop N    replay the recording N times back to back
+//   --reliable  RELIABLE writer (default BEST_EFFORT, which never blocks)
+//   --plain     publish RobotTelemetryPlain on robot_telemetry_plain (data-sharing QoS,
+//               always RELIABLE like the subscriber's data-sharing reader, so it
+//               cannot be combined with --reliable)
+
+volatile sig_atomic_t g_running = 1;
+
+void signalHandler(int signum)
+{
+    std::cout << "[Replay] Signal received (" << signum << "), stopping..." << std::endl;
+    g_running = 0;
+}
+
+namespace
+{
+    struct Options
+    {
+        std::string directory;
+        double speed = 1.0;          // 0 = as fast as possible
+        bool rewrite_timestamps = false;
+        int loops = 1;
+        bool reliable = false;
+        bool plain = false;
+    };
+
+    bool parseOptions(int argc, char** argv, Options& options)
+    {
+        if (argc < 2)
+            return false;
+
+        options.directory = argv[1];
+        for (int i = 2; i < argc; i++)
+        {
+            std::string arg = argv[i];
+            if (arg == "--speed" && i + 1 < argc)
+                options.speed = std::max(0.0, std::atof(argv[++i]));
+            else if (arg == "--max")
+                options.speed = 0.0;
+            else if (arg == "--now")
+                options.rewrite_timestamps = true;
+            else if (arg == "--loop" && i + 1 < argc)
+                options.loops = std::max(1, std::atoi(argv[++i]));
+            else if (arg == "--reliable")
+                options.reliable = true;
+            else if (arg == "--plain")
+                options.plain = true;
+            else
+                return false;
+        }
+
+        if (options.plain && options.reliable)
+        {
+            std::cerr << "[Replay] --reliable does not apply to --plain: the data-sharing writer is always RELIABLE"
+                      << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    uint64_t nowNs()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "=== Robot Telemetry Replay ===" << std::endl;
+
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        std::cerr << "usage: replay DIR [--speed N | --max] [--now] [--loop N] [--reliable] [--plain]" << std::endl;
+        return 1;
+    }
+
+    signal(SIGINT, signalHandler);
+    signal(SIGTERM, signalHandler);
+
+    // map every segment up front: the replay loop only reads memory
+    std::vector<std::string> paths = TelemetryRecording::listSegments(options.directory);
+    std::vector<std::unique_ptr<TelemetryRecording::SegmentReader>> segments;
+    uint64_t total = 0;
+    // the writer keeps one instance per robot, so it is sized for every id recorded
+    std::unordered_set<std::string> ids;
+    for (const std::string& path : paths)
+    {
+        std::unique_ptr<TelemetryRecording::SegmentReader> segment(new TelemetryRecording::SegmentReader());
+        if (!segment->open(path))
+        {
+            std::cerr << "[Replay] Skipping " << path << " (not a segment)" << std::endl;
+            continue;
+        }
+        if (segment->size() == 0)
+            continue;
+
+        for (std::size_t i = 0; i < segment->size(); i++)
+            ids.emplace(segment->record(i).id);
+
+        total += segment->size();
+        segments.push_back(std::move(segment));
+    }
+
+    if (segments.empty())
+    {
+        std::cerr << "[Replay] No recorded samples in " << options.directory << std::endl;
+        return 1;
+    }
+
+    int64_t first_ns = segments.front()->record(0).recorded_ns;
+    const TelemetryRecording::SegmentReader& last = *segments.back();
+    int64_t span_ns = last.record(last.size() - 1).recorded_ns - first_ns;
+
+    std::cout << "[Replay] " << total << " samples from " << ids.size() << " robot(s) in " << segments.size()
+              << " segment(s), " << std::fixed << std::setprecision(1) << span_ns / 1e9 << " s recorded" << std::endl;
+
+    // before any profile is built: max_instances = robots in the recording
+    QoSProfiles::setFleetSize(static_cast<int32_t>(std::min<std::size_t>(ids.size(), INT32_MAX)));
+
+    DataWriterQos qos = options.reliable ? QoSProfiles::getReliableTransientWriterQoS()
+                                         : QoSProfiles::getBestEffortWriterQoS();
+    RobotPublisher publisher;
+    bool initialized = options.plain
+        ? publisher.initPlain(QoSProfiles::getDataSharingWriterQoS())
+        : publisher.init(qos);
+    if (!initialized)
+    {
+        std::cerr << "[Replay] init error" << std::endl;
+        return 1;
+    }
+
+    std::cout << "[Replay] Waiting for subscribers..." << std::endl;
+    for (int i = 0; i < 100 && g_running && publisher.getMatchedSubscribers() == 0; i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    std::cout << "[Replay] Replaying at " << (options.speed > 0.0 ? std::to_string(options.speed) + "x" : "max speed")
+              << (options.rewrite_timestamps ? ", timestamps rewritten to now" : "")
+              << ", " << options.loops << " loop(s)" << std::endl;
+
+    // the fill callbacks are built once and read the current record through
+    // this pointer, so nothing is allocated per sample
+    const TelemetryRecording::Record* current = nullptr;
+    uint64_t timestamp = 0;
+    std::function<void(RobotTelemetry&)> fill = [&current, &timestamp](RobotTelemetry& sample)
+    {
+        TelemetryRecording::toTelemetry(*current, sample);
+        sample.timestamp(timestamp);
+    };
+    std::function<void(RobotTelemetryPlain&)> fill_plain = [&current, &timestamp](RobotTelemetryPlain& sample)
+    {
+        TelemetryConversions::setPlainId(sample, current->id);
+        sample.x(current->x);
+        sample.y(current->y);
+        sample.orientation(current->orientation);
+        sample.speed(current->speed);
+        sample.battery_level(current->battery_level);
+        sample.status(current->status);
+        sample.timestamp(timestamp);
+    };
+
+    uint64_t published = 0;
+    uint64_t failed = 0;
+    double max_lag_ms = 0.0;
+    // recorded time of loop n is shifted by n recording spans (+ 1 ms gap)
+    const int64_t loop_span_ns = span_ns + 1000000;
+    auto start = std::chrono::steady_clock::now();
+
+    for (int loop = 0; loop < options.loops && g_running; loop++)
+    {
+        for (std::size_t s = 0; s < segments.size() && g_running; s++)
+        {
+            const TelemetryRecording::SegmentReader& segment = *segments[s];
+            for (uint64_t i = 0; i < segment.size() && g_running; i++)
+            {
+                current = &segment.record(i);
+
+                if (options.speed > 0.0)
+                {
+                    // keep the recorded inter-arrival times, scaled by the speed
+                    int64_t offset_ns = current->recorded_ns - first_ns + loop * loop_span_ns;
+                    auto due = start + std::chrono::nanoseconds(static_cast<int64_t>(offset_ns / options.speed));
+                    auto now = std::chrono::steady_clock::now();
+                    if (due > now)
+                        std::this_thread::sleep_until(due);
+                    else
+                        max_lag_ms = std::max(max_lag_ms,
+                            std::chrono::duration<double, std::milli>(now - due).count());
+                }
+
+                timestamp = options.rewrite_timestamps ? nowNs() : current->timestamp;
+
+                bool ok = options.plain ? publisher.publishPlain(fill_plain) : publisher.publishLoaned(fill);
+                if (ok)
+                    published++;
+                else
+                    failed++;
+            }
+        }
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "\n[Replay] Statistics:" << std::endl;
+    std::cout << "  Published:   " << published << " (" << failed << " failed)" << std::endl;
+    std::cout << "  Duration:    " << std::setprecision(2) << elapsed.count() << " s" << std::endl;
+    std::cout << "  Rate:        " << std::setprecision(0) << published / elapsed.count() << " samples/s" << std::endl;
+    if (options.speed > 0.0)
+        std::cout << "  Max lag:     " << std::setprecision(2) << max_lag_ms << " ms behind the recorded timing" << std::endl;
+
+    publisher.stop();
+    std::cout << "[Replay] Done!" << std::endl;
+    return 0;
+}
@@ -1,7 +1,14 @@
 #include "RobotSubscriber.hpp"
 #include "QoSProfiles.hpp"
+#include "AsyncLogger.hpp"
+#include "RobotModels.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
 #include <iostream>
 #include <signal.h>
+#include <vector>
 
 volatile sig_atomic_t g_running = 1;
 
@@ -11,7 +18,75 @@ void signalHandler(int signum)
     g_running = 0;
 }
 
-int main()
+// value following `name` on the command line, or nullptr
+const char* argValue(int argc, char** argv, const std::string& name)
+{
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (name == argv[i])
+            return argv[i + 1];
+    }
+    return nullptr;
+}
+
+bool hasFlag(int argc, char** argv, const std::string& name)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        if (name == argv[i])
+            return true;
+    }
+    return false;
+}
+
+// latest state of each robot seen (from the subscriber's state store)
+void printFleet(const RobotStateStore& store)
+{
+    std::vector<RobotStateStore::RobotState> fleet;
+    std::size_t count = store.snapshot(fleet);
+
+    std::cout << "[Main subscriber] Robots tracked: " << count << std::endl;
+
+    const std::size_t shown = std::min<std::size_t>(count, 20);
+    for (std::size_t i = 0; i < shown; i++)
+    {
+        const RobotStateStore::RobotState& robot = fleet[i];
+        std::cout << "  " << std::setw(10) << std::left << robot.id << std::right
+                  << " | Pos: (" << std::fixed << std::setprecision(2)
+                  << std::setw(6) << robot.x << ", " << std::setw(6) << robot.y << ")"
+                  << " | Battery: " << std::setw(5) << robot.battery_level << "%"
+                  << " | Status: " << std::setw(12) << std::left << RobotModels::statusName(robot.status) << std::right
+                  << " | Samples: " << robot.updates << std::endl;
+    }
+    if (count > shown)
+        std::cout << "  ... " << count - shown << " more" << std::endl;
+}
+
+// 10 s roll-ups of one robot over the last minute
+void printHistory(const TelemetryHistory& history, const std::string& id)
+{
+    const std::size_t battery = static_cast<std::size_t>(TelemetryHistory::Metric::BATTERY);
+    const std::size_t speed = static_cast<std::size_t>(TelemetryHistory::Metric::SPEED);
+    uint64_t now = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+    uint64_t minute = 60ull * 1000000000ull;
+
+    std::cout << "[Main subscriber] " << id << ", last minute (10s buckets):" << std::endl;
+    history.visitRollup(id, TelemetryHistory::Tier::TEN_SECONDS, now > minute ? now - minute : 0, now,
+        [battery, speed](const TelemetryHistory::RollupSegment& segment)
+        {
+            for (std::size_t i = 0; i < segment.count; i++)
+            {
+                std::cout << "  " << std::setw(4) << segment.samples[i] << " samples"
+                          << " | Battery: " << std::fixed << std::setprecision(2)
+                          << segment.min[battery][i] << " - " << segment.max[battery][i] << "%"
+                          << " | Speed (mean/max): " << segment.mean[speed][i]
+                          << " / " << segment.max[speed][i] << " m/s" << std::endl;
+            }
+        });
+}
+
+int main(int argc, char** argv)
 {
     std::cout << "=== Robot Telemetry Subscriber ===" << std::endl;
     std::cout  << "Press ctrl+c or enter to stop" << std::endl;
@@ -19,36 +94,74 @@ int main()
     signal(SIGINT, signalHandler);
     signal(SIGTERM, signalHandler);
     
+    // received samples are printed by the logger thread (`--log-every N`: 1 in N per robot)
+    AsyncLogger& logger = AsyncLogger::instance();
+    logger.setSampling(AsyncLogger::Category::TELEMETRY, AsyncLogger::samplingFromArgs(argc, argv, 1));
+    logger.start();
+
+    // `--robots N`: fleet size (default QoSProfiles::kDefaultFleetSize), sizes the
+    // reader's instance limits and the per-robot tables below; 0 = no instance
+    // limit, the tables then keep the default size (~75 KB per robot)
+    const char* robots_arg = argValue(argc, argv, "--robots");
+    if (robots_arg != nullptr)
+        QoSProfiles::setFleetSize(std::atoi(robots_arg));
+    int32_t fleet_size = QoSProfiles::getFleetSize();
+    const std::size_t robots = static_cast<std::size_t>(fleet_size > 0 ? fleet_size : QoSProfiles::kDefaultFleetSize);
+    std::cout << "[Main subscriber] Fleet size: "
+              << (fleet_size > 0 ? std::to_string(fleet_size) : std::string("unlimited")) << " robots" << std::endl;
+
     RobotSubscriber subscriber;
+    subscriber.enableStateStore(robots);
+    subscriber.enableHistory(TelemetryHistory::defaultConfig(robots));
+
+    // `--record DIR`: append every sample to segment files in DIR
+    const char* record_dir = argValue(argc, argv, "--record");
+    if (record_dir != nullptr && !subscriber.enableRecorder(TelemetryRecorder::defaultConfig(record_dir)))
+    {
+        return 1;
+    }
 
     std::cout << "[Main] Select a QoS profile:" << std::endl;
     std::cout << "  1. RELIABLE + TRANSIENT_LOCAL (Receive historical messages too!)" << std::endl;
     std::cout << "  2. BEST_EFFORT (Fast, no guarantees)" << std::endl;
     std::cout << "  3. RELIABLE + DEADLINE (Timeout detection)" << std::endl;
     std::cout << "  4. DEFAULT (No custom QoS)" << std::endl;
-    std::cout << "Option [1-4]: ";
+    std::cout << "  5. DATA-SHARING (RobotTelemetryPlain, publisher on the same host)" << std::endl;
+    std::cout << "Option [1-5]: ";
 
     int choice;
     std::cin >> choice;
     std::cin.ignore();
 
     DataReaderQos qos;
+    bool plain = false;
+    const char* profile = "DEFAULT";
     switch(choice)
     {
         case 1:
             qos = QoSProfiles::getReliableTransientReaderQoS();
+            profile = "RELIABLE_TRANSIENT";
             std::cout << "\n[Main subscriber] Using: RELIABLE + TRANSIENT_LOCAL + KEEP_LAST(10)" << std::endl;
             std::cout << "[Main subscriber] NOTE: You will receive the last 10 historical messages upon connecting!" << std::endl;
             break;
         case 2:
             qos = QoSProfiles::getBestEffortReaderQoS();
+            profile = "BEST_EFFORT";
             std::cout << "\n[Main subscriber] Using: BEST_EFFORT + VOLATILE" << std::endl;
             break;
         case 3:
             qos = QoSProfiles::getReliableWithDeadlineReaderQoS();
+            profile = "RELIABLE_DEADLINE";
             std::cout << "\n[Main subscriber] Using: RELIABLE + DEADLINE(500ms)" << std::endl;
             std::cout << "[Main subscriber] NOTE: You will get an alert if the publisher does not send a message within 500ms!" << std::endl;
             break;
+        case 5:
+            qos = QoSProfiles::getDataSharingReaderQoS();
+            profile = "DATA_SHARING";
+            plain = true;
+            std::cout << "\n[Main subscriber] Using: DATA-SHARING + RELIABLE + KEEP_LAST(16) on robot_telemetry_plain" << std::endl;
+            std::cout << "[Main subscriber] NOTE: the publisher must also use option 5!" << std::endl;
+            break;
         case 4:
         default:
             qos = DATAREADER_QOS_DEFAULT;
@@ -56,8 +169,65 @@ int main()
             break;
     }
 
+    // publish -> receive latency, labelled with the profile;
+    // `--latency-report-ms N` sets the report interval (0 = only on exit)
+    const char* latency_ms = argValue(argc, argv, "--latency-report-ms");
+    subscriber.enableLatencyTracking(profile, robots,
+                                     latency_ms != nullptr ? std::atoi(latency_ms) : 5000);
+
 
-    if(!subscriber.init(qos))
+    std::cout << "\n[Main] Select a reader mode:" << std::endl;
+    std::cout << "  1. LISTENER (one sample per callback, DDS event thread)" << std::endl;
+    std::cout << "  2. WAITSET (batched take() on a dedicated thread)" << std::endl;
+    std::cout << "Option [1-2]: ";
+
+    int mode;
+    std::cin >> mode;
+    std::cin.ignore();
+
+    if (mode == 2)
+    {
+        subscriber.setReadMode(RobotSubscriber::ReadMode::WAITSET);
+        std::cout << "\n[Main subscriber] Using: WAITSET reader thread" << std::endl;
+    }
+    else
+    {
+        std::cout << "\n[Main subscriber] Using: LISTENER" << std::endl;
+    }
+
+    // `--fast-cdr`: fixed-layout RobotTelemetry deserializer (wire compatible)
+    // `--compact`: RobotTelemetryCompact from robot_telemetry_compact (publisher --compact)
+    bool compact = !plain && hasFlag(argc, argv, "--compact");
+    // `--delta`: RobotTelemetryDelta from robot_telemetry_delta (publisher --delta)
+    bool delta = !plain && !compact && hasFlag(argc, argv, "--delta");
+    // `--batch`: RobotTelemetryBatch from robot_telemetry_batch (publisher --batch);
+    // with --delta, RobotTelemetryDeltaBatch from robot_telemetry_delta_batch
+    bool batch = !plain && !compact && hasFlag(argc, argv, "--batch");
+    if (compact)
+        std::cout << "[Main subscriber] Reading RobotTelemetryCompact from robot_telemetry_compact" << std::endl;
+    if (delta && batch)
+        std::cout << "[Main subscriber] Reading RobotTelemetryDeltaBatch from robot_telemetry_delta_batch" << std::endl;
+    else if (delta)
+        std::cout << "[Main subscriber] Reading RobotTelemetryDelta from robot_telemetry_delta" << std::endl;
+    else if (batch)
+        std::cout << "[Main subscriber] Reading RobotTelemetryBatch from robot_telemetry_batch" << std::endl;
+
+    // `--peers a.b.c.d,...`: static discovery to these hosts, no multicast (publisher --peers)
+    DomainParticipantQos pqos = PARTICIPANT_QOS_DEFAULT;
+    if (const char* peers = argValue(argc, argv, "--peers"))
+    {
+        pqos = QoSProfiles::getStaticPeersParticipantQoS(QoSProfiles::splitPeers(peers));
+        std::cout << "[Main subscriber] Static discovery, initial peers: " << peers << std::endl;
+    }
+
+    subscriber.setFastSerialization(hasFlag(argc, argv, "--fast-cdr"));
+    bool initialized = plain ? subscriber.initPlain(qos, pqos)
+        : compact ? subscriber.initCompact(qos, pqos)
+        : delta && batch ? subscriber.initDeltaBatch(qos, pqos)
+        : delta ? subscriber.initDelta(qos, pqos)
+        : batch ? subscriber.initBatch(qos, pqos)
+        : subscriber.init(qos, pqos);
+    if(!initialized)
     {   
         std::cerr << "[Main subscriber] init error"<<std::endl;
         return 1;
@@ -67,11 +237,20 @@ int main()
     std::cout << "[Main subscriber] messages will apear here" << std::endl;
     
     subscriber.run();
-    std::cout << "[Main subscriber] Statistics: " << std::endl;
-    std::cout << "Total messages received: " << subscriber.getTotalMessages() <<std::endl;
-    std::cout << "Publishers connected: " << subscriber.getMatchedPublishers() << std::endl;
 
+    // the reader logs until it is deleted: stop DDS first and the logger last
+    int matched = subscriber.getMatchedPublishers();
     subscriber.stop();
+    logger.stop();
+
+    std::cout << "[Main subscriber] Statistics: " << std::endl;
+    std::cout << "Total messages received: " << subscriber.getTotalMessages() <<std::endl;
+    std::cout << "Publishers connected: " << matched << std::endl;
+    if (subscriber.getReadMode() == RobotSubscriber::ReadMode::WAITSET)
+        std::cout << "WaitSet read errors (retried): " << subscriber.getReadErrors() << std::endl;
+    printFleet(*subscriber.getStateStore());
+    if (subscriber.getHistory()->size() > 0)
+        printHistory(*subscriber.getHistory(), subscriber.getHistory()->robotId(0));
 
     std::cout << "[Main] Done!" << std::endl;
 